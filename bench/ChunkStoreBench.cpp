@@ -0,0 +1,95 @@
+#include "World.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <random>
+
+/**
+ * Benchmark of block lookups through ChunkStore against the std::map layout
+ * World used before it (std::map<int, std::vector<int>> with a float floor
+ * division per access). Two access patterns are timed over 64 resident
+ * chunks: a row-by-row scan of the visible area, where consecutive lookups
+ * hit the same chunk, and uniformly random tiles, which defeat the
+ * last-chunk cache.
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const int CHUNKS = 64;
+    const int FIRST_CHUNK = -CHUNKS / 2;
+    const int LOOKUPS = 20000000;
+
+    double nanosPerLookup(Clock::time_point start, int lookups) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;
+    }
+
+    // The old World::getBlock
+    int mapGetBlock(std::map<int, std::vector<int>>& chunks, int x, int y) {
+        int chunkX = static_cast<int>(std::floor(static_cast<float>(x) / CHUNK_WIDTH));
+        int localX = ((x % CHUNK_WIDTH) + CHUNK_WIDTH) % CHUNK_WIDTH;
+        auto it = chunks.find(chunkX);
+        if (it == chunks.end()) return AIR;
+        return it->second[y * CHUNK_WIDTH + localX];
+    }
+
+    // The current World::getBlock
+    int storeGetBlock(ChunkStore& store, int x, int y) {
+        Chunk* chunk = store.find(x >> CHUNK_SHIFT);
+        if (!chunk) return AIR;
+        return chunk->blocks.get(y * CHUNK_WIDTH + (x & CHUNK_MASK));
+    }
+}
+
+int main() {
+    std::mt19937 rng(3);
+    std::map<int, std::vector<int>> map;
+    ChunkStore store;
+    for (int chunkX = FIRST_CHUNK; chunkX < FIRST_CHUNK + CHUNKS; ++chunkX) {
+        std::vector<int> ids(CHUNK_WIDTH * WORLD_HEIGHT);
+        for (int& id : ids) id = (rng() % 4 == 0) ? ItemID::STONE : ItemID::DIRT;
+
+        map[chunkX] = ids;
+        auto chunk = std::make_unique<Chunk>();
+        chunk->blocks = BlockStorage(CHUNK_WIDTH * WORLD_HEIGHT);
+        chunk->blocks.assign(ids);
+        store.insert(chunkX, std::move(chunk));
+    }
+
+    // Row-major scans of the resident columns, then random tiles
+    const int minX = FIRST_CHUNK * CHUNK_WIDTH, columns = CHUNKS * CHUNK_WIDTH;
+    std::vector<int> randomX(1 << 16), randomY(1 << 16);
+    for (size_t i = 0; i < randomX.size(); ++i) {
+        randomX[i] = minX + static_cast<int>(rng() % columns);
+        randomY[i] = static_cast<int>(rng() % WORLD_HEIGHT);
+    }
+    const size_t randomMask = randomX.size() - 1;
+
+    auto scan = [&](auto getBlock) {
+        long long sum = 0;
+        Clock::time_point start = Clock::now();
+        for (int n = 0; n < LOOKUPS;) {
+            for (int y = 0; y < WORLD_HEIGHT && n < LOOKUPS; ++y) {
+                for (int x = minX; x < minX + columns && n < LOOKUPS; ++x, ++n) sum += getBlock(x, y);
+            }
+        }
+        std::printf("%8.2f ns/lookup (checksum %lld)\n", nanosPerLookup(start, LOOKUPS), sum);
+    };
+    auto random = [&](auto getBlock) {
+        long long sum = 0;
+        Clock::time_point start = Clock::now();
+        for (int n = 0; n < LOOKUPS; ++n) sum += getBlock(randomX[n & randomMask], randomY[n & randomMask]);
+        std::printf("%8.2f ns/lookup (checksum %lld)\n", nanosPerLookup(start, LOOKUPS), sum);
+    };
+
+    auto viaMap = [&](int x, int y) { return mapGetBlock(map, x, y); };
+    auto viaStore = [&](int x, int y) { return storeGetBlock(store, x, y); };
+
+    std::printf("Block lookups over %d chunks, %d lookups each\n", CHUNKS, LOOKUPS);
+    std::printf("  scan,   std::map:   "); scan(viaMap);
+    std::printf("  scan,   ChunkStore: "); scan(viaStore);
+    std::printf("  random, std::map:   "); random(viaMap);
+    std::printf("  random, ChunkStore: "); random(viaStore);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "Noise.h"
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/**
+ * Benchmark of world generation: full-pipeline chunk throughput of
+ * TerrainGenerator on one thread, before (std::sin per column and per stone
+ * cell) and after (batched kernels), and the sine/cosine kernels of Noise
+ * against a std::sin loop over the same inputs.
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const int CHUNKS = 2000;
+    const int VALUES = 1 << 16;   // Inputs per kernel pass (fits in L2)
+    const int PASSES = 1000;
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Generates CHUNKS chunks in one wave mode (best of three runs).
+     * @return Chunks per second; blocks receives every block ID in order.
+     */
+    double generateAll(TerrainGenerator::WaveMode mode, std::vector<int>& blocks) {
+        TerrainGenerator terrain(12345);
+        terrain.setWaveMode(mode);
+
+        std::vector<std::unique_ptr<Chunk>> chunks(CHUNKS);
+        double best = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < CHUNKS; ++i) chunks[i] = terrain.generate(i - CHUNKS / 2);
+            best = std::max(best, CHUNKS / secondsSince(start));
+        }
+
+        blocks.clear();
+        for (const std::unique_ptr<Chunk>& chunk : chunks) {
+            for (int i = 0; i < chunk->blocks.size(); ++i) blocks.push_back(chunk->blocks.get(i));
+        }
+        return best;
+    }
+
+    void benchGeneration() {
+        std::vector<int> before, after;
+        double beforeRate = generateAll(TerrainGenerator::WaveMode::PerBlockScalar, before);
+        double afterRate = generateAll(TerrainGenerator::WaveMode::Batched, after);
+
+        size_t differing = 0;
+        for (size_t i = 0; i < before.size(); ++i) differing += (before[i] != after[i]);
+
+        std::printf("TerrainGenerator::generate, %d chunks (best of 3)\n", CHUNKS);
+        std::printf("  before (std::sin per block): %8.1f chunks/s  (%.3f ms/chunk)\n", beforeRate, 1000.0 / beforeRate);
+        std::printf("  after  (batched kernels):    %8.1f chunks/s  (%.3f ms/chunk, %.2fx)\n", afterRate, 1000.0 / afterRate, afterRate / beforeRate);
+        std::printf("  blocks differing between the two: %zu of %zu\n", differing, after.size());
+    }
+
+    void benchKernels() {
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> angle(-2000.0f, 2000.0f); // Typical wave arguments
+        std::vector<float> in(VALUES), out(VALUES), reference(VALUES);
+        for (float& x : in) x = angle(rng);
+
+        auto run = [&](const char* label, auto kernel) {
+            double sum = 0.0;
+            Clock::time_point start = Clock::now();
+            for (int pass = 0; pass < PASSES; ++pass) {
+                kernel();
+                sum += out[pass & (VALUES - 1)];
+            }
+            double seconds = secondsSince(start);
+            std::printf("  %-12s %8.1f Mvalues/s  (checksum %.3f)\n",
+                        label, static_cast<double>(VALUES) * PASSES / seconds / 1e6, sum);
+        };
+
+        std::printf("Noise kernels (%s), %d values x %d passes\n", Noise::getKernelName(), VALUES, PASSES);
+        run("std::sin", [&]() { for (int i = 0; i < VALUES; ++i) out[i] = std::sin(in[i]); });
+        run("sinBatch", [&]() { Noise::sinBatch(in.data(), out.data(), VALUES); });
+        run("std::cos", [&]() { for (int i = 0; i < VALUES; ++i) out[i] = std::cos(in[i]); });
+        run("cosBatch", [&]() { Noise::cosBatch(in.data(), out.data(), VALUES); });
+
+        // Accuracy against the double-precision reference
+        Noise::sinBatch(in.data(), out.data(), VALUES);
+        float maxError = 0.0f;
+        for (int i = 0; i < VALUES; ++i) {
+            reference[i] = static_cast<float>(std::sin(static_cast<double>(in[i])));
+            maxError = std::max(maxError, std::abs(out[i] - reference[i]));
+        }
+        std::printf("  sinBatch max error vs std::sin: %.2e\n", maxError);
+    }
+}
+
+int main() {
+    benchGeneration();
+    benchKernels();
+    return 0;
+}
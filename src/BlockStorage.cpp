@@ -0,0 +1,106 @@
+#include "BlockStorage.h"
+
+BlockStorage::BlockStorage(int size)
+    : mSize(size)
+    , mBits(4)
+    , mEntriesShift(4)
+    , mEntriesMask(15)
+    , mValueMask(15)
+{
+    mPalette.push_back(0); // Air
+    mPacked.assign((size + 15) / 16, 0);
+}
+
+int BlockStorage::findPaletteIndex(int id) const {
+    for (size_t i = 0; i < mPalette.size(); ++i) {
+        if (mPalette[i] == id) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void BlockStorage::set(int index, int id) {
+    if (mBits == 16) {
+        mWide[index] = static_cast<uint16_t>(id);
+        return;
+    }
+
+    int paletteIndex = findPaletteIndex(id);
+    if (paletteIndex < 0) {
+        if (mPalette.size() > mValueMask) {
+            // Palette is full at this width: widen (4 -> 8 -> raw 16) and retry
+            std::vector<int> ids = toVector();
+            ids[index] = id;
+            encode(ids, (mBits == 4) ? 8 : 16);
+            return;
+        }
+        paletteIndex = static_cast<int>(mPalette.size());
+        mPalette.push_back(static_cast<uint16_t>(id));
+    }
+
+    uint64_t& word = mPacked[index >> mEntriesShift];
+    int shift = (index & mEntriesMask) * mBits;
+    word = (word & ~(mValueMask << shift)) | (static_cast<uint64_t>(paletteIndex) << shift);
+}
+
+void BlockStorage::assign(const std::vector<int>& ids) {
+    // Count distinct IDs to pick the tightest width. Air is always in the
+    // palette (encode() keeps it at index 0), so it counts even when absent.
+    std::vector<int> distinct(1, 0);
+    for (int id : ids) {
+        bool known = false;
+        for (int d : distinct) {
+            if (d == id) { known = true; break; }
+        }
+        if (!known) {
+            distinct.push_back(id);
+            if (distinct.size() > 256) break;
+        }
+    }
+
+    int bits = 16;
+    if (distinct.size() <= 16) bits = 4;
+    else if (distinct.size() <= 256) bits = 8;
+    encode(ids, bits);
+}
+
+void BlockStorage::encode(const std::vector<int>& ids, int bits) {
+    mSize = static_cast<int>(ids.size());
+    mBits = bits;
+    mPalette.clear();
+    mPacked.clear();
+    mWide.clear();
+
+    if (bits == 16) {
+        mWide.assign(ids.begin(), ids.end());
+        return;
+    }
+
+    int entriesPerWord = 64 / bits;
+    mEntriesShift = (bits == 4) ? 4 : 3;
+    mEntriesMask = entriesPerWord - 1;
+    mValueMask = (uint64_t(1) << bits) - 1;
+
+    mPalette.push_back(0); // Keep Air at index 0 so empty words decode as Air
+    mPacked.assign((mSize + entriesPerWord - 1) / entriesPerWord, 0);
+
+    for (int i = 0; i < mSize; ++i) {
+        int paletteIndex = findPaletteIndex(ids[i]);
+        if (paletteIndex < 0) {
+            paletteIndex = static_cast<int>(mPalette.size());
+            mPalette.push_back(static_cast<uint16_t>(ids[i]));
+        }
+        mPacked[i >> mEntriesShift] |= static_cast<uint64_t>(paletteIndex) << ((i & mEntriesMask) * bits);
+    }
+}
+
+std::vector<int> BlockStorage::toVector() const {
+    std::vector<int> ids(mSize);
+    for (int i = 0; i < mSize; ++i) ids[i] = get(i);
+    return ids;
+}
+
+size_t BlockStorage::getMemoryUsage() const {
+    return mPalette.capacity() * sizeof(uint16_t) +
+           mPacked.capacity() * sizeof(uint64_t) +
+           mWide.capacity() * sizeof(uint16_t);
+}
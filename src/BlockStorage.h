@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BlockStorage
+ * @brief Compact storage for one layer of chunk cells (block or wall IDs).
+ *
+ * A chunk rarely holds more than a dozen distinct IDs, so each cell stores a
+ * small index into a per-layer palette, packed into 64-bit words. Air is
+ * always palette entry 0, so it counts towards these limits even when absent:
+ * - up to 16 distinct IDs: 4 bits per cell
+ * - up to 256 distinct IDs: 8 bits per cell
+ * - more than that: falls back to raw uint16_t IDs (no palette)
+ *
+ * The encoding widens automatically when set() introduces a new ID that does
+ * not fit, and assign() repacks to the tightest width.
+ */
+class BlockStorage {
+public:
+    /**
+     * @brief Creates a layer of 'size' cells, all Air (0).
+     */
+    explicit BlockStorage(int size = 0);
+
+    /**
+     * @brief Reads the ID stored in a cell.
+     * @param index Row-major cell index (y * CHUNK_WIDTH + localX).
+     */
+    int get(int index) const {
+        if (mBits == 16) return mWide[index];
+        uint64_t word = mPacked[index >> mEntriesShift];
+        int shift = (index & mEntriesMask) * mBits;
+        return mPalette[(word >> shift) & mValueMask];
+    }
+
+    /**
+     * @brief Writes an ID into a cell, widening the encoding if needed.
+     */
+    void set(int index, int id);
+
+    /**
+     * @brief Replaces the whole layer with the given IDs (size() must match).
+     */
+    void assign(const std::vector<int>& ids);
+
+    /**
+     * @brief Expands the layer back into plain IDs (used for saving).
+     */
+    std::vector<int> toVector() const;
+
+    int size() const { return mSize; }
+    int getBitsPerCell() const { return mBits; }
+
+    /**
+     * @brief Approximate heap bytes used by this layer.
+     */
+    size_t getMemoryUsage() const;
+
+private:
+    int findPaletteIndex(int id) const;
+    void encode(const std::vector<int>& ids, int bits);
+
+    int mSize;
+    int mBits;           // 4, 8 or 16 (16 = raw IDs)
+    int mEntriesShift;   // log2(cells per 64-bit word)
+    int mEntriesMask;    // Cells per word - 1
+    uint64_t mValueMask; // (1 << mBits) - 1
+
+    std::vector<uint16_t> mPalette; // Palette index -> ID
+    std::vector<uint64_t> mPacked;  // Packed palette indices (4/8-bit modes)
+    std::vector<uint16_t> mWide;    // Raw IDs (16-bit mode)
+};
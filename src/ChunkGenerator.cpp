@@ -0,0 +1,116 @@
+#include "ChunkGenerator.h"
+#include <algorithm>
+
+namespace {
+    // Min-heap ordering: the lowest priority value sits at the front
+    struct LaterJob {
+        template <typename Job>
+        bool operator()(const Job& a, const Job& b) const { return a.priority > b.priority; }
+    };
+}
+
+ChunkGenerator::ChunkGenerator(uint64_t seed)
+    : mTerrain(std::make_shared<const TerrainGenerator>(seed))
+    , mEpoch(0)
+    , mStopping(false)
+{
+    // Leave one core for the main thread
+    unsigned int cores = std::thread::hardware_concurrency();
+    unsigned int workerCount = std::clamp(cores > 1 ? cores - 1 : 1u, 1u, 3u);
+
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        mWorkers.emplace_back(&ChunkGenerator::workerLoop, this);
+    }
+}
+
+ChunkGenerator::~ChunkGenerator() {
+    {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        mStopping = true;
+        mQueue.clear();
+    }
+    mQueueCondition.notify_all();
+
+    for (std::thread& worker : mWorkers) worker.join();
+}
+
+void ChunkGenerator::setSeed(uint64_t seed) {
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    mTerrain = std::make_shared<const TerrainGenerator>(seed);
+    mEpoch++;
+    mQueue.clear();
+}
+
+void ChunkGenerator::schedule(const std::vector<std::pair<float, int>>& requests) {
+    {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        mQueue.clear();
+        for (const auto& request : requests) {
+            if (mInFlight.count(request.second)) continue;
+            mQueue.push_back({ request.first, request.second });
+        }
+        std::make_heap(mQueue.begin(), mQueue.end(), LaterJob());
+    }
+    mQueueCondition.notify_all();
+}
+
+std::vector<std::pair<int, std::unique_ptr<Chunk>>> ChunkGenerator::takeCompleted() {
+    std::vector<Result> results;
+    {
+        std::unique_lock<std::mutex> lock(mCompletedMutex, std::try_to_lock);
+        if (!lock.owns_lock()) return {};
+        results.swap(mCompleted);
+    }
+
+    if (results.empty()) return {};
+
+    // Only now may these chunks be requested again: until the caller stores
+    // them, a new request would generate them a second time
+    {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        for (const Result& result : results) mInFlight.erase(result.chunkX);
+    }
+
+    // mEpoch is only written by the main thread, which is the caller here
+    std::vector<std::pair<int, std::unique_ptr<Chunk>>> chunks;
+    for (Result& result : results) {
+        if (result.epoch != mEpoch) continue; // Built for a previous seed
+        chunks.emplace_back(result.chunkX, std::move(result.chunk));
+    }
+    return chunks;
+}
+
+size_t ChunkGenerator::getQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    return mQueue.size();
+}
+
+/**
+ * @brief Worker thread body: pops the most urgent request and generates it.
+ */
+void ChunkGenerator::workerLoop() {
+    while (true) {
+        Job job;
+        uint32_t epoch;
+        std::shared_ptr<const TerrainGenerator> terrain;
+        {
+            std::unique_lock<std::mutex> lock(mQueueMutex);
+            mQueueCondition.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+            if (mStopping) return;
+
+            std::pop_heap(mQueue.begin(), mQueue.end(), LaterJob());
+            job = mQueue.back();
+            mQueue.pop_back();
+
+            mInFlight.insert(job.chunkX);
+            epoch = mEpoch;
+            terrain = mTerrain; // Keep this seed's generator alive even if the seed changes
+        }
+
+        std::unique_ptr<Chunk> chunk = terrain->generate(job.chunkX);
+
+        // The chunk stays in mInFlight until takeCompleted() hands it over
+        std::lock_guard<std::mutex> lock(mCompletedMutex);
+        mCompleted.push_back({ job.chunkX, epoch, std::move(chunk) });
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "TerrainGenerator.h"
+
+/**
+ * @class ChunkGenerator
+ * @brief Background worker pool that generates chunks ahead of the camera.
+ *
+ * The main thread replaces the request queue once per frame with schedule()
+ * and collects finished chunks with takeCompleted(). Workers never touch the
+ * World or its ChunkStore, so block reads on the main thread take no lock;
+ * the only synchronization is the short queue handoff on each side.
+ */
+class ChunkGenerator {
+public:
+    explicit ChunkGenerator(uint64_t seed);
+    ~ChunkGenerator();
+
+    ChunkGenerator(const ChunkGenerator&) = delete;
+    ChunkGenerator& operator=(const ChunkGenerator&) = delete;
+
+    /**
+     * @brief Switches to a new world seed.
+     * Queued requests are dropped and chunks still in flight for the old seed
+     * are discarded when they complete.
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * @brief The terrain algorithm for the current seed (for synchronous fallback).
+     */
+    const TerrainGenerator& getTerrain() const { return *mTerrain; }
+
+    /**
+     * @brief Replaces the pending queue with a new set of requests.
+     * @param requests Pairs of (priority, chunkX); lower priority values are generated first.
+     * Chunks already being generated, or finished but not yet taken, are skipped.
+     */
+    void schedule(const std::vector<std::pair<float, int>>& requests);
+
+    /**
+     * @brief Moves out every chunk finished since the last call.
+     * Never waits on a publishing worker: the results then wait for the next frame.
+     * The returned chunks may be scheduled again afterwards.
+     */
+    std::vector<std::pair<int, std::unique_ptr<Chunk>>> takeCompleted();
+
+    size_t getQueuedCount() const;
+    size_t getWorkerCount() const { return mWorkers.size(); }
+
+private:
+    struct Job {
+        float priority;
+        int chunkX;
+    };
+
+    struct Result {
+        int chunkX;
+        uint32_t epoch; // Seed generation the chunk was built for
+        std::unique_ptr<Chunk> chunk;
+    };
+
+    void workerLoop();
+
+    std::vector<std::thread> mWorkers;
+
+    // Request side (guarded by mQueueMutex)
+    mutable std::mutex mQueueMutex;
+    std::condition_variable mQueueCondition;
+    std::vector<Job> mQueue;          // Min-heap on priority
+    std::unordered_set<int> mInFlight; // Chunks being generated or waiting in mCompleted
+    std::shared_ptr<const TerrainGenerator> mTerrain;
+    uint32_t mEpoch;                  // Bumped on every seed change
+    bool mStopping;
+
+    // Completion side (guarded by mCompletedMutex)
+    std::mutex mCompletedMutex;
+    std::vector<Result> mCompleted;
+};
@@ -0,0 +1,31 @@
+#include "ChunkMesh.h"
+
+ChunkMesh::ChunkMesh(int sectionCount)
+    : mSections(sectionCount)
+{
+}
+
+void ChunkMesh::markDirty(int section) {
+    if (section >= 0 && section < getSectionCount()) mSections[section].dirty = true;
+}
+
+void ChunkMesh::addQuad(Section& section, const sf::FloatRect& bounds, const sf::IntRect& texRect, Shade shade) {
+    float left = bounds.left;
+    float top = bounds.top;
+    float right = bounds.left + bounds.width;
+    float bottom = bounds.top + bounds.height;
+
+    float texLeft = static_cast<float>(texRect.left);
+    float texTop = static_cast<float>(texRect.top);
+    float texRight = static_cast<float>(texRect.left + texRect.width);
+    float texBottom = static_cast<float>(texRect.top + texRect.height);
+
+    // Depth trick: background walls are darkened by 50% so they visually sit "behind"
+    sf::Color color = (shade == Shade::Wall) ? sf::Color(128, 128, 128) : sf::Color::White;
+
+    // Clockwise from the top-left corner
+    section.vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(texLeft, texTop)));
+    section.vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(texRight, texTop)));
+    section.vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(texRight, texBottom)));
+    section.vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(texLeft, texBottom)));
+}
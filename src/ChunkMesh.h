@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class ChunkMesh
+ * @brief Cached geometry of one chunk, split into vertical sections.
+ *
+ * Each section holds one quad per visible tile (background walls first, then
+ * foreground blocks) with texture coordinates into the world's texture atlas,
+ * so the whole section is a single draw call. Sections are rebuilt only after
+ * one of their tiles (or an autotile neighbour) changes.
+ *
+ * Vertices are unlit: lighting is multiplied over the finished scene by the
+ * world's lightmap pass, so a section never changes between rebuilds.
+ */
+class ChunkMesh {
+public:
+    /**
+     * @brief Base tint of a quad, baked into its vertex colors.
+     */
+    enum class Shade : uint8_t {
+        Block, // Foreground block (untinted)
+        Wall   // Background wall (half brightness so it sits "behind")
+    };
+
+    struct Section {
+        sf::VertexArray vertices{ sf::Quads }; // 4 vertices per tile
+        bool dirty = true;                     // Must be rebuilt before drawing
+    };
+
+    explicit ChunkMesh(int sectionCount);
+
+    int getSectionCount() const { return static_cast<int>(mSections.size()); }
+    Section& getSection(int index) { return mSections[index]; }
+
+    /**
+     * @brief Flags a section for rebuilding (out-of-range indices are ignored).
+     */
+    void markDirty(int section);
+
+    /**
+     * @brief Appends one tile quad to a section.
+     * @param bounds World rectangle covered by the tile (pixels).
+     * @param texRect Source rectangle in the atlas texture.
+     */
+    static void addQuad(Section& section, const sf::FloatRect& bounds, const sf::IntRect& texRect, Shade shade);
+
+private:
+    std::vector<Section> mSections;
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @enum RngStream
+ * @brief Identifies an independent random stream inside one chunk's generation.
+ * Each generation step draws from its own stream so adding or removing draws
+ * in one step never shifts the numbers another step sees.
+ */
+enum class RngStream : uint32_t {
+    Ores = 2,
+    Trees = 3, // One stream per tree (chunkX carries the tree's root column)
+    Noise = 4 // Permutation tables of the gradient-noise fields (chunkX carries the field salt)
+};
+
+/**
+ * @class ChunkRng
+ * @brief Counter-based random generator (SplitMix64) for world generation.
+ *
+ * The stream is derived only from (worldSeed, chunkX, stream), so a chunk's
+ * contents no longer depend on the order in which chunks are generated.
+ * hash() gives a stateless value for a single coordinate when a whole stream
+ * is not needed.
+ */
+class ChunkRng {
+public:
+    ChunkRng(uint64_t worldSeed, int chunkX, RngStream stream)
+        : mState(mix(worldSeed ^ mix((static_cast<uint64_t>(stream) << 32) | static_cast<uint32_t>(chunkX))))
+    {
+    }
+
+    /**
+     * @brief Next raw 32-bit value of the stream.
+     */
+    uint32_t next() {
+        mState += GOLDEN_GAMMA;
+        return static_cast<uint32_t>(mix(mState) >> 32);
+    }
+
+    /**
+     * @brief Uniform integer in [0, bound) (multiply-shift, no modulo).
+     */
+    int nextInt(int bound) {
+        return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(bound)) >> 32);
+    }
+
+    /**
+     * @brief Stateless 32-bit hash of a world coordinate.
+     */
+    static uint32_t hash(uint64_t worldSeed, int x, int y) {
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+        return static_cast<uint32_t>(mix(worldSeed ^ mix(key + GOLDEN_GAMMA)) >> 32);
+    }
+
+private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+    // SplitMix64 finalizer
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t mState;
+};
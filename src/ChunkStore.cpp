@@ -0,0 +1,108 @@
+#include "ChunkStore.h"
+
+namespace {
+    const size_t INITIAL_CAPACITY = 64;
+}
+
+ChunkStore::ChunkStore()
+    : mSlots(INITIAL_CAPACITY)
+    , mMask(INITIAL_CAPACITY - 1)
+    , mCount(0)
+    , mLastKey(0)
+    , mLastChunk(nullptr)
+{
+}
+
+/**
+ * @brief Fibonacci hashing: spreads consecutive chunk indices across the table.
+ */
+size_t ChunkStore::indexFor(int chunkX) const {
+    uint32_t h = static_cast<uint32_t>(chunkX) * 2654435769u;
+    return static_cast<size_t>(h ^ (h >> 16)) & mMask;
+}
+
+Chunk* ChunkStore::findSlow(int chunkX) {
+    size_t i = indexFor(chunkX);
+    while (mSlots[i].chunk) {
+        if (mSlots[i].key == chunkX) {
+            mLastKey = chunkX;
+            mLastChunk = mSlots[i].chunk.get();
+            return mLastChunk;
+        }
+        i = (i + 1) & mMask;
+    }
+    return nullptr;
+}
+
+Chunk& ChunkStore::insert(int chunkX, std::unique_ptr<Chunk> chunk) {
+    // Keep the load factor at or below 50% so probe chains stay short
+    if ((mCount + 1) * 2 > mSlots.size()) grow();
+
+    size_t i = indexFor(chunkX);
+    while (mSlots[i].chunk && mSlots[i].key != chunkX) {
+        i = (i + 1) & mMask;
+    }
+
+    if (!mSlots[i].chunk) mCount++;
+    mSlots[i].key = chunkX;
+    mSlots[i].chunk = std::move(chunk);
+
+    mLastKey = chunkX;
+    mLastChunk = mSlots[i].chunk.get();
+    return *mLastChunk;
+}
+
+bool ChunkStore::erase(int chunkX) {
+    size_t i = indexFor(chunkX);
+    while (mSlots[i].chunk && mSlots[i].key != chunkX) {
+        i = (i + 1) & mMask;
+    }
+    if (!mSlots[i].chunk) return false;
+
+    if (mLastChunk == mSlots[i].chunk.get()) mLastChunk = nullptr;
+    mSlots[i].chunk.reset();
+    mCount--;
+
+    // Backward-shift deletion: pull later members of the probe chain into the hole
+    // so lookups never need tombstones.
+    size_t hole = i;
+    size_t j = (i + 1) & mMask;
+    while (mSlots[j].chunk) {
+        size_t home = indexFor(mSlots[j].key);
+        // Move the entry if its home slot is not cyclically within (hole, j]
+        bool canMove = (hole <= j) ? (home <= hole || home > j) : (home <= hole && home > j);
+        if (canMove) {
+            mSlots[hole].key = mSlots[j].key;
+            mSlots[hole].chunk = std::move(mSlots[j].chunk);
+            hole = j;
+        }
+        j = (j + 1) & mMask;
+    }
+    return true;
+}
+
+void ChunkStore::clear() {
+    for (Slot& slot : mSlots) slot.chunk.reset();
+    mCount = 0;
+    mLastChunk = nullptr;
+}
+
+/**
+ * @brief Doubles the capacity and re-inserts every chunk.
+ * Chunks are owned by pointer, so the cached last chunk stays valid.
+ */
+void ChunkStore::grow() {
+    std::vector<Slot> old;
+    old.swap(mSlots);
+
+    mSlots.resize(old.size() * 2);
+    mMask = mSlots.size() - 1;
+
+    for (Slot& slot : old) {
+        if (!slot.chunk) continue;
+        size_t i = indexFor(slot.key);
+        while (mSlots[i].chunk) i = (i + 1) & mMask;
+        mSlots[i].key = slot.key;
+        mSlots[i].chunk = std::move(slot.chunk);
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "BlockStorage.h"
+
+/**
+ * @enum ChunkStage
+ * @brief How far generation has progressed for a chunk, in pipeline order.
+ * Far-field queries only advance a chunk as far as they need; a stage may
+ * read neighbouring chunks at an earlier stage.
+ */
+enum class ChunkStage : uint8_t {
+    Empty,     // Nothing generated yet
+    Heightmap, // Surface height of every column (heights only, layers still empty)
+    Terrain,   // Base blocks, biome pockets and background walls
+    Caves,     // Worm tunnels and chambers carved
+    Ores,      // Ore veins placed
+    Decorated, // Trees placed
+    Complete   // Ready to be rendered, edited and saved
+};
+
+/**
+ * @struct Chunk
+ * @brief The block data of one vertical slice of the world (CHUNK_WIDTH x WORLD_HEIGHT).
+ */
+struct Chunk {
+    BlockStorage blocks; // Foreground blocks, row-major (y * CHUNK_WIDTH + localX)
+    BlockStorage walls;  // Background wall layer, same layout
+
+    ChunkStage stage = ChunkStage::Empty;
+    std::vector<int> heights; // Surface row of each column (from the Heightmap stage on)
+    std::vector<uint8_t> masks; // Autotile neighbour mask of each block, same layout (Complete chunks only)
+    std::vector<uint8_t> light; // Block light level of each cell, same layout (see LightEngine)
+    std::vector<uint8_t> skyTop; // Row of the highest solid block of each column (WORLD_HEIGHT if none)
+    std::vector<uint16_t> solid; // Solid blocks of each row as a bitset, bit = local column (Complete chunks only)
+
+    uint64_t lastUsed = 0; // World frame of the last access (LRU eviction)
+    bool dirty = false;    // Differs from its on-disk copy (must be spilled before eviction)
+};
+
+/**
+ * @class ChunkStore
+ * @brief O(1) container of chunks keyed by chunk index.
+ *
+ * Open-addressing hash table (linear probing, power-of-two capacity) that owns
+ * its chunks through unique_ptr, so a Chunk never moves in memory once created.
+ * The most recently used chunk is cached, which turns the common pattern of
+ * many lookups into the same chunk (collision, autotiling, lighting) into a
+ * single integer compare.
+ */
+class ChunkStore {
+public:
+    ChunkStore();
+
+    /**
+     * @brief Finds a resident chunk.
+     * @param chunkX The chunk index.
+     * @return The chunk, or nullptr if it is not in the store.
+     */
+    Chunk* find(int chunkX) {
+        if (chunkX == mLastKey && mLastChunk) return mLastChunk;
+        return findSlow(chunkX);
+    }
+
+    /**
+     * @brief Stores a chunk, replacing any chunk already stored at that index.
+     * @return A reference to the stored chunk (stable until it is erased).
+     */
+    Chunk& insert(int chunkX, std::unique_ptr<Chunk> chunk);
+
+    /**
+     * @brief Removes a chunk from the store.
+     * @return True if a chunk was removed.
+     */
+    bool erase(int chunkX);
+
+    void clear();
+
+    size_t size() const { return mCount; }
+
+    /**
+     * @brief Calls func(chunkX, chunk) for every resident chunk (unordered).
+     */
+    template <typename Func>
+    void forEach(Func func) const {
+        for (const Slot& slot : mSlots) {
+            if (slot.chunk) func(slot.key, *slot.chunk);
+        }
+    }
+
+private:
+    struct Slot {
+        int key = 0;
+        std::unique_ptr<Chunk> chunk; // nullptr marks an empty slot
+    };
+
+    Chunk* findSlow(int chunkX);
+    size_t indexFor(int chunkX) const;
+    void grow();
+
+    std::vector<Slot> mSlots;
+    size_t mMask;   // Capacity - 1 (capacity is a power of two)
+    size_t mCount;
+
+    // Last-chunk fast path
+    int mLastKey;
+    Chunk* mLastChunk;
+};
@@ -46,9 +46,8 @@ bool Dodo::takeDamage(int amount, float knockbackDir) {
  * @param dt Time elapsed since the last frame.
  * @param playerPos The player's current position (used when aggro).
  * @param world Reference to the game world for collision detection.
- * @param lightLevel The current ambient light level for coloring.
  */
-void Dodo::update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) {
+void Dodo::update(sf::Time dt, sf::Vector2f playerPos, World& world) {
     float dtSec = dt.asSeconds();
     if (mDamageTimer > 0.0f) mDamageTimer -= dtSec;
     if (mAttackCooldown > 0.0f) mAttackCooldown -= dtSec;
@@ -110,84 +109,50 @@ void Dodo::update(sf::Time dt, sf::Vector2f playerPos, World& world, float light
     // ==========================================
     // 2. PRO PHYSICS AND ANTICIPATION SENSOR
     // ==========================================
-    auto checkCollision = [&](sf::FloatRect rect) {
-        // Use std::floor to ensure collisions don't break in negative map coordinates
-        int left = static_cast<int>(std::floor(rect.left / world.getTileSize()));
-        int right = static_cast<int>(std::floor((rect.left + rect.width) / world.getTileSize()));
-        int top = static_cast<int>(std::floor(rect.top / world.getTileSize()));
-        int bottom = static_cast<int>(std::floor((rect.top + rect.height) / world.getTileSize()));
-        for (int x = left; x <= right; ++x) {
-            for (int y = top; y <= bottom; ++y) {
-                if (World::isSolid(world.getBlock(x, y))) return true;
-            }
-        }
-        return false;
-    };
+    const TileCollision& collision = world.getCollision();
 
     // --- REAL GROUND DETECTOR ---
-    // Create an invisible 2-pixel sensor right under the feet
-    sf::FloatRect groundSensor = getBounds();
-    groundSensor.top += groundSensor.height;
-    groundSensor.height = 2.0f;
-    bool isGrounded = (mVel.y >= 0.0f && checkCollision(groundSensor));
-
-    float dx = mVel.x * dtSec;
-    mPos.x += dx;
-    mSprite.setPosition(mPos);
-
-    sf::FloatRect boundsX = getBounds();
-    boundsX.height -= 15.0f; // Cut ankles to step over small bumps
+    // Solid tiles within 2 pixels under the feet
+    bool isGrounded = (mVel.y >= 0.0f && collision.isOnGround(getBounds()));
 
     // --- VISUAL ANTICIPATION SENSOR (Jump over obstacles) ---
-    // We now use isGrounded instead of mVel.y == 0
     if (isGrounded && std::abs(mVel.x) > 0.0f) {
-        sf::FloatRect sensor = boundsX;
+        sf::FloatRect sensor = getBounds();
+        sensor.height -= 15.0f; // Cut ankles so the floor itself is not an obstacle
         sensor.left += (mVel.x > 0) ? 25.0f : -25.0f; // Look ahead
 
-        if (checkCollision(sensor)) {
+        if (collision.overlapsSolid(sensor)) {
             if (mIsAggro) {
                 mVel.y = -380.0f;
                 isGrounded = false; // Take off!
             } else {
                 mWanderDir *= -1; // Turn around if peaceful
                 mVel.x = mWanderDir * 40.0f;
-                dx = mVel.x * dtSec;
             }
         }
     }
 
-    // Real physical collision X
-    if (checkCollision(boundsX)) {
-        mPos.x -= dx;
-        if (mIsAggro && isGrounded) {
-            mVel.y = -380.0f;
-            isGrounded = false;
-        }
-        else if (!mIsAggro) mWanderDir *= -1;
-        mSprite.setPosition(mPos);
-    }
-
-    // Gravity Y
+    // Gravity
     mVel.y += 1000.0f * dtSec;
     if (mVel.y > 800.0f) mVel.y = 800.0f; // Terminal velocity
-    float dy = mVel.y * dtSec;
-    mPos.y += dy;
+
+    // Real physical collision (swept, X then Y)
+    TileCollision::MoveResult move = collision.move(getBounds(), mVel * dtSec);
+    mPos += move.offset;
     mSprite.setPosition(mPos);
 
-    sf::FloatRect boundsY = getBounds();
-    // Real physical collision Y
-    if (checkCollision(boundsY)) {
-        if (mVel.y > 0.0f) { // Hitting ground
-            int blockY = static_cast<int>(std::floor((boundsY.top + boundsY.height) / world.getTileSize()));
-            float newY = blockY * world.getTileSize();
-            if (std::abs(mPos.y - newY) < world.getTileSize() * 2.0f) mPos.y = newY;
-            else mPos.y -= dy;
-            mVel.y = 0.0f;
-            isGrounded = true; // Lands
-        } else if (mVel.y < 0.0f) { // Hitting ceiling
-            mPos.y -= dy; mVel.y = 0.0f;
+    if (move.hitFloor) {
+        mVel.y = 0.0f;
+        isGrounded = true; // Lands
+    } else if (move.hitCeiling) {
+        mVel.y = 0.0f;
+    }
+    if (move.hitWall) {
+        if (mIsAggro && isGrounded) {
+            mVel.y = -380.0f;
+            isGrounded = false;
         }
-        mSprite.setPosition(mPos);
+        else if (!mIsAggro) mWanderDir *= -1;
     }
 
     // ==========================================
@@ -215,16 +180,7 @@ void Dodo::update(sf::Time dt, sf::Vector2f playerPos, World& world, float light
     // Visuals and damage tint
     float currentScale = std::abs(mSprite.getScale().y);
     mSprite.setScale(mFacingRight ? currentScale : -currentScale, currentScale);
-    if (mDamageTimer > 0.0f) {
-        mSprite.setColor(sf::Color::Red);
-    } else {
-        // Base color affected by world lighting
-        mSprite.setColor(sf::Color(
-            std::min(255, (int)(255 * lightLevel) + 20),
-            std::min(255, (int)(255 * lightLevel) + 20),
-            std::min(255, (int)(255 * lightLevel) + 20)
-        ));
-    }
+    mSprite.setColor((mDamageTimer > 0.0f) ? sf::Color::Red : sf::Color::White);
 }
 
 // ==========================================
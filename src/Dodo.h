@@ -29,9 +29,8 @@ public:
      * @param dt Time elapsed since the last frame.
      * @param playerPos The player's current position (used when aggro).
      * @param world Reference to the game world for collision detection.
-     * @param lightLevel The current ambient light level for coloring.
      */
-    void update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) override;
+    void update(sf::Time dt, sf::Vector2f playerPos, World& world) override;
 
     /**
      * @brief Overrides the default damage response to trigger the aggressive state.
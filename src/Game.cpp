@@ -2,10 +2,20 @@
 #include <cmath> // Necessary for std::sqrt
 #include <iostream>
 #include <algorithm> // For std::clamp, std::min, std::max
+#include <cstdio>    // For std::snprintf (debug overlay)
+#include <random>    // For std::random_device (world seed)
 
 #include "Dodo.h"
 #include "Troodon.h"
 
+/**
+ * @brief Draws a fresh 64-bit world seed from the OS entropy source.
+ */
+static uint64_t makeWorldSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) | device();
+}
+
 /**
  * @brief Constructor for the Game class.
  * Initializes the window, loads resources (textures, sounds, fonts),
@@ -14,7 +24,7 @@
 Game::Game()
     : mWindow(sf::VideoMode(1920, 1080), "TerraForge C++")
     , mPlayer()
-    , mWorld()
+    , mWorld(makeWorldSeed())
     , mSelectedBlock(1)
     , mGameTime(0.0f)
     , mAmbientLight(sf::Color::White)
@@ -156,59 +166,6 @@ Game::Game()
     // Special Recipe: Boss Summoning Item
     mRecipes.push_back({ItemID::MEAT_MEDALLION, 1, true, {{ItemID::MEAT, 30}}});
 
-    // --- ITEM DATABASE (Defines weight and max stack for each item) ---
-    // Blocks
-    mItemDatabase[ItemID::DIRT] = {"Dirt", 1.0f, 99};
-    mItemDatabase[ItemID::STONE] = {"Stone", 2.0f, 99};
-    mItemDatabase[ItemID::WOOD] = {"Log", 1.5f, 99};
-    mItemDatabase[ItemID::LEAVES] = {"Leaves", 0.1f, 99};
-    mItemDatabase[ItemID::TORCH] = {"Torch", 0.2f, 99};
-    mItemDatabase[ItemID::SAND] = {"Sand", 1.0f, 99};
-    mItemDatabase[ItemID::SNOW] = {"Snow", 1.0f, 99};
-
-    // Minerals
-    mItemDatabase[ItemID::COAL] = {"Coal", 1.0f, 99};
-    mItemDatabase[ItemID::COPPER] = {"Copper", 2.0f, 99};
-    mItemDatabase[ItemID::IRON] = {"Iron", 2.0f, 99};
-    mItemDatabase[ItemID::COBALT] = {"Cobalt", 2.0f, 99};
-    mItemDatabase[ItemID::TUNGSTEN] = {"Tungsten", 2.0f, 99};
-
-    // Tools and Consumables
-    mItemDatabase[ItemID::WOOD_PICKAXE] = {"Wood Pickaxe", 5.0f, 1};
-    mItemDatabase[ItemID::STONE_PICKAXE] = {"Stone Pickaxe", 5.0f, 1};
-    mItemDatabase[ItemID::IRON_PICKAXE] = {"Iron Pickaxe", 5.0f, 1};
-    mItemDatabase[ItemID::TUNGSTEN_PICKAXE] = {"Tungsten Pickaxe", 5.0f, 1};
-    mItemDatabase[ItemID::MEAT] = {"Meat", 0.5f, 20};
-
-    // Weapons
-    mItemDatabase[ItemID::WOOD_SWORD] = {"Wood Sword", 4.0f, 1};
-    mItemDatabase[ItemID::STONE_SWORD] = {"Stone Sword", 4.0f, 1};
-    mItemDatabase[ItemID::IRON_SWORD] = {"Iron Sword", 4.0f, 1};
-    mItemDatabase[ItemID::TUNGSTEN_SWORD] = {"Tungsten Sword", 4.0f, 1};
-    mItemDatabase[ItemID::BOW] = {"Bow", 3.0f, 1};
-    mItemDatabase[ItemID::ARROW] = {"Arrow", 0.1f, 99};
-
-    // Structures
-    mItemDatabase[ItemID::DOOR] = {"Wooden Door", 5.0f, 99};
-    mItemDatabase[ItemID::CRAFTING_TABLE] = {"Crafting Table", 3.0f, 99};
-    mItemDatabase[ItemID::FURNACE] = {"Furnace", 4.0f, 99};
-    mItemDatabase[ItemID::CHEST] = {"Chest", 4.0f, 99};
-
-    // Ingots
-    mItemDatabase[ItemID::IRON_INGOT] = {"Iron Ingot", 1.5f, 99};
-    mItemDatabase[ItemID::COPPER_INGOT] = {"Copper Ingot", 1.5f, 99};
-    mItemDatabase[ItemID::COBALT_INGOT] = {"Cobalt Ingot", 1.5f, 99};
-    mItemDatabase[ItemID::TUNGSTEN_INGOT] = {"Tungsten Ingot", 1.5f, 99};
-
-    // Armor
-    mItemDatabase[ItemID::WOOD_HELMET] = {"Wood Helmet", 2.0f, 1};
-    mItemDatabase[ItemID::WOOD_CHEST]  = {"Wood Chest", 4.0f, 1};
-    mItemDatabase[ItemID::WOOD_LEGS]   = {"Wood Legs", 3.0f, 1};
-    mItemDatabase[ItemID::WOOD_BOOTS]  = {"Wood Boots", 1.5f, 1};
-
-    // Special
-    mItemDatabase[ItemID::MEAT_MEDALLION] = {"Meat Medallion", 10.0f, 1};
-
     // --- LOAD ENTITY TEXTURES ---
     if (!mDodoTexture.loadFromFile("assets/Dodo.png")) std::cerr << "Error: Missing Dodo.png" << std::endl;
     if (!mTroodonTexture.loadFromFile("assets/Troodon.png")) std::cerr << "Error: Missing Troodon.png" << std::endl;
@@ -326,6 +283,7 @@ void Game::processEvents() {
                     mIsFurnaceOpen = false;
                     mIsChestOpen = false;
                     mIsCraftingTableOpen = false;
+                    invalidateMenus();
 
                     // Return dragged item to inventory to prevent item loss/duplication
                     if (mDraggedItem.id != ItemID::AIR) {
@@ -343,6 +301,11 @@ void Game::processEvents() {
             }
         }
 
+        // --- DEBUG OVERLAY TOGGLE ---
+        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+            mShowDebugOverlay = !mShowDebugOverlay;
+        }
+
         // --- MAIN MENU INTERACTION ---
         if (mGameState == GameState::MainMenu && event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(mWindow);
@@ -362,6 +325,7 @@ void Game::processEvents() {
                     mCinematicPhase = 0;
                     float finalX = 100 * mWorld.getTileSize();
                     mCapsulePos = sf::Vector2f(finalX - 3000.0f, -3000.0f);
+                    mCapsuleVelocity = sf::Vector2f(2000.0f, 2000.0f);
                     mCameraPos = mCapsulePos; // La cámara sigue a la cápsula
                 }
                 else if (mMenuLoadGameText.getGlobalBounds().contains(worldPos)) {
@@ -393,6 +357,7 @@ void Game::processEvents() {
         // --- INVENTORY TOGGLE (E Key) ---
         if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::E) {
             mIsInventoryOpen = !mIsInventoryOpen;
+            invalidateMenus();
             if (!mIsInventoryOpen) {
                 mIsChestOpen = false;
                 mIsFurnaceOpen = false;
@@ -411,6 +376,7 @@ void Game::processEvents() {
         if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Q) {
             if (mIsInventoryOpen) {
                 mIsArmorWheelActive = !mIsArmorWheelActive;
+                invalidateMenus();
             }
         }
 
@@ -443,79 +409,6 @@ void Game::processEvents() {
     }
 }
 
-/**
- * @brief Helper function to determine the base mining time required for a block.
- */
-float getBlockHardness(int id) {
-    switch (id) {
-        case ItemID::AIR: return 0.0f;
-        case ItemID::DIRT: return 0.2f;  // Fast break
-        case ItemID::WOOD: return 0.6f;
-        case ItemID::LEAVES: return 0.1f;  // Instant break
-        case ItemID::TORCH: return 0.1f;
-
-        // Doors
-        case ItemID::DOOR: case ItemID::DOOR_MID: case ItemID::DOOR_TOP:
-        case ItemID::DOOR_OPEN: case ItemID::DOOR_OPEN_MID: case ItemID::DOOR_OPEN_TOP:
-            return 0.5f;
-
-        // Interactive Blocks
-        case ItemID::CRAFTING_TABLE: return 1.5f;
-        case ItemID::FURNACE: return 2.0f; // Hard stone structure
-        case ItemID::CHEST: return 1.5f;
-
-        // Stone and Minerals
-        case ItemID::STONE: return 1.0f;
-        case ItemID::COAL: return 1.2f;
-        case ItemID::COPPER: return 1.5f;
-        case ItemID::IRON: return 2.0f;
-        case ItemID::COBALT: return 3.0f;
-        case ItemID::TUNGSTEN: return 5.0f;
-
-        case ItemID::BEDROCK: return -1.0f; // Indestructible
-
-        default: return 1.0f;
-    }
-}
-
-/**
- * @brief Tool Tier Progression. Determines the mining level of a given tool.
- */
-int getPickaxeTier(int itemID) {
-    switch (itemID) {
-        case ItemID::WOOD_PICKAXE: return 1;
-        case ItemID::STONE_PICKAXE: return 2;
-        case ItemID::IRON_PICKAXE: return 3;
-        case ItemID::TUNGSTEN_PICKAXE: return 4;
-        default: return 0; // Fists or unrelated items
-    }
-}
-
-/**
- * @brief Determines the minimum tool tier required to drop the item block.
- */
-int getRequiredPickaxeTier(int blockID) {
-    switch (blockID) {
-        // Tier 1 (Wood Pickaxe+)
-        case ItemID::STONE:
-        case ItemID::COAL:
-        case ItemID::FURNACE: return 1;
-
-        // Tier 2 (Stone Pickaxe+)
-        case ItemID::COPPER:
-        case ItemID::IRON: return 2;
-
-        // Tier 3 (Iron Pickaxe+)
-        case ItemID::COBALT:
-        case ItemID::TUNGSTEN: return 3;
-
-        case ItemID::BEDROCK: return 999;
-
-        // Dirt, wood, leaves, etc. can be broken by hand (Tier 0)
-        default: return 0;
-    }
-}
-
 /**
  * @brief Main logic update loop.
  * Handles the cinematic sequence, day/night cycle, physics, entity updates,
@@ -529,6 +422,9 @@ void Game::update(sf::Time dt) {
     if (mGameState == GameState::IntroCinematic) {
         mCinematicTimer += dt.asSeconds();
 
+        // Pre-generate the crash site while the intro text is on screen
+        mWorld.streamChunks(mCapsulePos, mCapsuleVelocity);
+
         // PHASE 0: Fade in Year Text
         if (mCinematicPhase == 0) {
             float alpha = std::clamp((mCinematicTimer / 2.0f) * 255.0f, 0.0f, 255.0f);
@@ -552,8 +448,7 @@ void Game::update(sf::Time dt) {
         // PHASE 2: Capsule Freefall & Crash
         else if (mCinematicPhase == 2) {
             // Meteor velocity
-            mCapsulePos.x += 2000.0f * dt.asSeconds();
-            mCapsulePos.y += 2000.0f * dt.asSeconds();
+            mCapsulePos += mCapsuleVelocity * dt.asSeconds();
 
             mCameraPos = mCapsulePos; // Camera tracks the drop
 
@@ -564,7 +459,7 @@ void Game::update(sf::Time dt) {
             int gridX = static_cast<int>((mCapsulePos.x + 20.0f) / mWorld.getTileSize());
             int gridY = static_cast<int>((mCapsulePos.y + 20.0f) / mWorld.getTileSize());
 
-            if (World::isSolid(mWorld.getBlock(gridX, gridY))) {
+            if (mWorld.isSolidAt(gridX, gridY)) {
                 // MASSIVE IMPACT: Carve out a crater
                 int craterRadius = 3;
 
@@ -646,24 +541,21 @@ void Game::update(sf::Time dt) {
         FurnaceData& fd = pair.second;
 
         // Map input ore to output ingot
-        int resultItem = 0;
-        if (fd.input.id == ItemID::COPPER) resultItem = ItemID::COPPER_INGOT;
-        else if (fd.input.id == ItemID::IRON) resultItem = ItemID::IRON_INGOT;
-        else if (fd.input.id == ItemID::COBALT) resultItem = ItemID::COBALT_INGOT;
-        else if (fd.input.id == ItemID::TUNGSTEN) resultItem = ItemID::TUNGSTEN_INGOT;
+        int resultItem = itemProperties(fd.input.id).smeltResult;
 
         // Validate smelting conditions (valid ore + space in output)
         bool canCook = (resultItem != 0 && fd.input.count > 0 &&
-                       (fd.output.id == 0 || (fd.output.id == resultItem && fd.output.count < 99)));
+                       (fd.output.id == 0 || (fd.output.id == resultItem && fd.output.count < itemProperties(resultItem).maxStack)));
 
         // Consume fuel if needed
         if (canCook && fd.fuelTimer <= 0.0f) {
-            if ((fd.fuel.id == ItemID::WOOD || fd.fuel.id == ItemID::COAL) && fd.fuel.count > 0) {
-                int fuelType = fd.fuel.id;
+            float burnTime = itemProperties(fd.fuel.id).burnTime;
+            if (burnTime > 0.0f && fd.fuel.count > 0) {
                 fd.fuel.count--;
                 if (fd.fuel.count == 0) fd.fuel.id = 0;
+                invalidateMenus();
 
-                fd.maxFuelTimer = (fuelType == ItemID::COAL) ? 40.0f : 10.0f;
+                fd.maxFuelTimer = burnTime;
                 fd.fuelTimer = fd.maxFuelTimer;
             }
         }
@@ -682,6 +574,7 @@ void Game::update(sf::Time dt) {
                     fd.output.id = resultItem;
                     fd.output.count++;
                     fd.smeltTimer = 0.0f;
+                    invalidateMenus();
                 }
             } else {
                 fd.smeltTimer = 0.0f; // Pause progress if ore is removed or output is full
@@ -692,11 +585,11 @@ void Game::update(sf::Time dt) {
     }
 
     // Update Player Armor visuals
-    mPlayer.setArmorAnimTextures(
-        mWorld.getArmorAnimTexture(mArmorHead.id),
-        mWorld.getArmorAnimTexture(mArmorChest.id),
-        mWorld.getArmorAnimTexture(mArmorLegs.id),
-        mWorld.getArmorAnimTexture(mArmorBoots.id)
+    mPlayer.setArmorAnimRegions(
+        mWorld.getArmorAnimRegion(mArmorHead.id),
+        mWorld.getArmorAnimRegion(mArmorChest.id),
+        mWorld.getArmorAnimRegion(mArmorLegs.id),
+        mWorld.getArmorAnimRegion(mArmorBoots.id)
     );
 
     mPlayer.update(dt, mWorld);
@@ -722,6 +615,7 @@ void Game::update(sf::Time dt) {
                 mIsChestOpen = false;
                 mIsFurnaceOpen = false;
                 mIsInventoryOpen = false;
+                invalidateMenus();
 
                 // Return dragged items
                 if (mDraggedItem.id != ItemID::AIR) {
@@ -743,6 +637,7 @@ void Game::update(sf::Time dt) {
 
     // --- ITEM PICKUP SYSTEM ---
     std::map<int, int> pickedUpItems;
+    mWorld.streamChunks(mPlayer.getCenter(), mPlayer.getVelocity()); // Background generation ahead of the player
     mWorld.update(dt, mPlayer.getCenter(), pickedUpItems); // World detects collisions with dropped items
 
     for (const auto& item : pickedUpItems) {
@@ -753,9 +648,7 @@ void Game::update(sf::Time dt) {
         if (!addItemToBackpack(id, cantidad)) {
             int pGridX = static_cast<int>(mPlayer.getPosition().x / mWorld.getTileSize());
             int pGridY = static_cast<int>(mPlayer.getPosition().y / mWorld.getTileSize());
-            for(int i = 0; i < cantidad; i++) {
-                mWorld.spawnItem(pGridX, pGridY, id);
-            }
+            mWorld.spawnItem(pGridX, pGridY, id, cantidad);
         }
     }
 
@@ -806,6 +699,9 @@ void Game::update(sf::Time dt) {
         }
     }
 
+    // Include mobs summoned since the last rebuild in the player's hit and placement tests
+    rebuildMobGrid();
+
     // --- RANGE CALCULATIONS FOR INTERACTION ---
     sf::Vector2i pixelPos = sf::Mouse::getPosition(mWindow);
     sf::Vector2f worldPos = mWindow.mapPixelToCoords(pixelPos);
@@ -843,7 +739,8 @@ void Game::update(sf::Time dt) {
                 float speed = 1800.0f; // High velocity arrows
                 sf::Vector2f velocity((dirX / length) * speed, (dirY / length) * speed);
 
-                mProjectiles.push_back(std::make_unique<Projectile>(pPos, velocity, *mWorld.getTexture(ItemID::ARROW)));
+                TextureAtlas::Region arrow = mWorld.getItemRegion(ItemID::ARROW);
+                mProjectiles.push_back(std::make_unique<Projectile>(pPos, velocity, *arrow.texture, arrow.rect));
 
                 mSndBuild.setPitch(2.0f); // Higher pitch for arrow loose
                 mSndBuild.play();
@@ -854,29 +751,20 @@ void Game::update(sf::Time dt) {
         }
         // --- MELEE: SWORDS & PICKAXES ---
         else {
-            int toolDamage = 1; // Default fist damage
-            if (equippedID == ItemID::WOOD_PICKAXE) toolDamage = 3;
-            if (equippedID == ItemID::STONE_PICKAXE) toolDamage = 5;
-            if (equippedID == ItemID::IRON_PICKAXE) toolDamage = 8;
-            if (equippedID == ItemID::TUNGSTEN_PICKAXE) toolDamage = 12;
-            if (equippedID == ItemID::WOOD_SWORD) toolDamage = 6;
-            if (equippedID == ItemID::STONE_SWORD) toolDamage = 10;
-            if (equippedID == ItemID::IRON_SWORD) toolDamage = 18;
-            if (equippedID == ItemID::TUNGSTEN_SWORD) toolDamage = 30;
+            int toolDamage = itemProperties(equippedID).damage; // 1 for fists
 
             sf::FloatRect attackHitbox = mPlayer.getWeaponHitbox();
 
-            for (auto& mob : mMobs) {
-                if (attackHitbox.intersects(mob->getBounds())) {
-                    float dir = (mPlayer.getPosition().x < mob->getPosition().x) ? 1.0f : -1.0f;
-                    if (mob->takeDamage(toolDamage, dir)) {
-                        mSndHit.setPitch(1.0f + (rand() % 40) / 100.0f);
-                        mSndHit.play();
-                        spawnParticles(mob->getBounds().getPosition() + sf::Vector2f(mob->getBounds().getSize().x / 2.0f, 0.0f), ItemID::MEAT, 8);
-                    }
-                    mPlayer.registerHit();
-                    break; // Hit only one mob per swing
+            mMobGrid.queryRect(attackHitbox, mMobQuery);
+            if (!mMobQuery.empty()) {
+                auto& mob = mMobs[mMobQuery.front()]; // Hit only one mob per swing
+                float dir = (mPlayer.getPosition().x < mob->getPosition().x) ? 1.0f : -1.0f;
+                if (mob->takeDamage(toolDamage, dir)) {
+                    mSndHit.setPitch(1.0f + (rand() % 40) / 100.0f);
+                    mSndHit.play();
+                    spawnParticles(mob->getBounds().getPosition() + sf::Vector2f(mob->getBounds().getSize().x / 2.0f, 0.0f), ItemID::MEAT, 8);
                 }
+                mPlayer.registerHit();
             }
         }
     }
@@ -905,7 +793,7 @@ void Game::update(sf::Time dt) {
                             mCurrentHardness = std::max(0.6f, 0.2f * blocksAbove);
                         }
                         else {
-                            mCurrentHardness = getBlockHardness(blockID);
+                            mCurrentHardness = itemProperties(blockID).hardness;
                         }
                     } else {
                         mCurrentHardness = 0.0f; // Looking at air
@@ -914,22 +802,11 @@ void Game::update(sf::Time dt) {
 
                 // Process Mining
                 if (mCurrentHardness > 0.0f) {
-                    float miningSpeed = 1.0f;
-                    int equippedID = mSelectedBlock;
-                    int targetID = mWorld.getBlock(gridX, gridY);
+                    const ItemProperties& tool = itemProperties(mSelectedBlock);
+                    int requiredTier = itemProperties(mWorld.getBlock(gridX, gridY)).requiredTier;
 
-                    int pickaxeTier = getPickaxeTier(equippedID);
-                    int requiredTier = getRequiredPickaxeTier(targetID);
-
-                    if (pickaxeTier < requiredTier) {
-                        miningSpeed = 0.0f; // Invalid tool, cannot mine
-                    } else {
-                        if (equippedID == ItemID::WOOD_PICKAXE) miningSpeed = 3.0f;
-                        else if (equippedID == ItemID::STONE_PICKAXE) miningSpeed = 5.0f;
-                        else if (equippedID == ItemID::IRON_PICKAXE) miningSpeed = 10.0f;
-                        else if (equippedID == ItemID::TUNGSTEN_PICKAXE) miningSpeed = 20.0f;
-                        else if (equippedID >= ItemID::WOOD_SWORD && equippedID <= ItemID::TUNGSTEN_SWORD) miningSpeed = 1.5f;
-                    }
+                    // Invalid tool, cannot mine
+                    float miningSpeed = (tool.pickaxeTier < requiredTier) ? 0.0f : tool.miningSpeed;
 
                     mMiningTimer += dt.asSeconds() * miningSpeed;
 
@@ -943,7 +820,7 @@ void Game::update(sf::Time dt) {
                             if (mActiveChests.find(posKey) != mActiveChests.end()) {
                                 for (const auto& slot : mActiveChests[posKey].slots) {
                                     if (slot.id != ItemID::AIR && slot.count > 0) {
-                                        for(int i=0; i<slot.count; i++) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, slot.id);
+                                        mWorld.spawnItem(mMiningPos.x, mMiningPos.y, slot.id, slot.count);
                                     }
                                 }
                                 mActiveChests.erase(posKey);
@@ -952,9 +829,9 @@ void Game::update(sf::Time dt) {
                         else if (brokenBlockID == ItemID::FURNACE) {
                             if (mActiveFurnaces.find(posKey) != mActiveFurnaces.end()) {
                                 auto& fd = mActiveFurnaces[posKey];
-                                if (fd.input.id != 0) for(int i=0; i<fd.input.count; i++) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.input.id);
-                                if (fd.fuel.id != 0) for(int i=0; i<fd.fuel.count; i++) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.fuel.id);
-                                if (fd.output.id != 0) for(int i=0; i<fd.output.count; i++) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.output.id);
+                                if (fd.input.id != 0 && fd.input.count > 0) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.input.id, fd.input.count);
+                                if (fd.fuel.id != 0 && fd.fuel.count > 0) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.fuel.id, fd.fuel.count);
+                                if (fd.output.id != 0 && fd.output.count > 0) mWorld.spawnItem(mMiningPos.x, mMiningPos.y, fd.output.id, fd.output.count);
                                 mActiveFurnaces.erase(posKey);
                             }
                         }
@@ -1068,6 +945,7 @@ void Game::update(sf::Time dt) {
                 if (mPlayer.getHp() < mPlayer.getMaxHp() && wheel[mActiveWheelSlot]->count > 0) {
                     wheel[mActiveWheelSlot]->count--;
                     if (wheel[mActiveWheelSlot]->count == 0) wheel[mActiveWheelSlot]->id = 0;
+                    invalidateMenus();
 
                     mPlayer.heal(20);
                     mSndBuild.setPitch(0.5f); // Chomping sound approximation
@@ -1080,6 +958,7 @@ void Game::update(sf::Time dt) {
                 if (wheel[mActiveWheelSlot]->count > 0) {
                     wheel[mActiveWheelSlot]->count--;
                     if (wheel[mActiveWheelSlot]->count == 0) wheel[mActiveWheelSlot]->id = 0;
+                    invalidateMenus();
 
                     sf::Vector2f spawnPos(mPlayer.getPosition().x, mPlayer.getPosition().y - 800.0f); // Drop from sky
                     mMobs.push_back(std::make_unique<TRex>(spawnPos, mTRexTexture));
@@ -1110,7 +989,7 @@ void Game::update(sf::Time dt) {
                         if (mWorld.getBlock(gridX, gridY) == ItemID::AIR &&
                             mWorld.getBlock(gridX, gridY - 1) == ItemID::AIR &&
                             mWorld.getBlock(gridX, gridY - 2) == ItemID::AIR &&
-                            World::isSolid(mWorld.getBlock(gridX, gridY + 1)))
+                            mWorld.isSolidAt(gridX, gridY + 1))
                         {
                             mWorld.setBlock(gridX, gridY, ItemID::DOOR);         // Base
                             mWorld.setBlock(gridX, gridY - 1, ItemID::DOOR_MID); // Middle
@@ -1118,6 +997,7 @@ void Game::update(sf::Time dt) {
 
                             wheel[mActiveWheelSlot]->count--;
                             if (wheel[mActiveWheelSlot]->count == 0) wheel[mActiveWheelSlot]->id = 0;
+                            invalidateMenus();
 
                             mSndBuild.setPitch(1.0f + (rand() % 20) / 100.0f);
                             mSndBuild.play();
@@ -1131,18 +1011,15 @@ void Game::update(sf::Time dt) {
 
                         // Prevent placing blocks inside the player or enemies
                         if (!mPlayer.getGlobalBounds().intersects(blockRect)) {
-                            bool isMobInWay = false;
-                            for (auto& mob : mMobs) {
-                                if (mob->getBounds().intersects(blockRect)) {
-                                    isMobInWay = true; break;
-                                }
-                            }
+                            mMobGrid.queryRect(blockRect, mMobQuery);
+                            bool isMobInWay = !mMobQuery.empty();
 
                             if (!isMobInWay) {
                                 mWorld.setBlock(gridX, gridY, mSelectedBlock);
 
                                 wheel[mActiveWheelSlot]->count--;
                                 if (wheel[mActiveWheelSlot]->count == 0) wheel[mActiveWheelSlot]->id = 0;
+                                invalidateMenus();
 
                                 mSndBuild.setPitch(1.0f + (rand() % 20) / 100.0f);
                                 mSndBuild.play();
@@ -1182,26 +1059,19 @@ void Game::update(sf::Time dt) {
             float spawnY = 0.0f;
             bool groundFound = false;
 
-            // Raycast down to find surface
-            for (int y = 1; y < WORLD_HEIGHT; ++y) {
-                if (World::isSolid(mWorld.getBlock(gridX, y))) {
-                    bool isSpaceClear = true;
-                    // Check a 3x3 area above the ground for safety
-                    for (int checkX = gridX - 1; checkX <= gridX + 1; ++checkX) {
-                        for (int checkY = y - 3; checkY <= y - 1; ++checkY) {
-                            if (checkY >= 0 && World::isSolid(mWorld.getBlock(checkX, checkY))) {
-                                isSpaceClear = false;
-                                break;
-                            }
-                        }
-                        if (!isSpaceClear) break;
-                    }
-
-                    if (isSpaceClear) {
-                        spawnY = y * mWorld.getTileSize();
-                        groundFound = true;
-                    }
-                    break;
+            // Raycast down to find surface. The spawn point is usually far outside
+            // the generated area; trees are not solid and caves start well below
+            // the surface, so the base terrain stage gives the same answer.
+            float columnX = (gridX + 0.5f) * mWorld.getTileSize();
+            World::RaycastHit ground = mWorld.raycast(sf::Vector2f(columnX, mWorld.getTileSize()),
+                                                      sf::Vector2f(columnX, WORLD_HEIGHT * mWorld.getTileSize() - 1.0f),
+                                                      ChunkStage::Terrain);
+            if (ground.hit) {
+                int y = ground.tile.y;
+                // Check a 3x3 area above the ground for safety
+                if (!mWorld.isAreaSolid(gridX - 1, y - 3, 3, 3, ChunkStage::Terrain)) {
+                    spawnY = y * mWorld.getTileSize();
+                    groundFound = true;
                 }
             }
 
@@ -1217,45 +1087,12 @@ void Game::update(sf::Time dt) {
         }
     }
 
-    // Determine global light factor for mob rendering
-    float currentBrightness = (mGameTime > (DAY_LENGTH * 0.5f)) ? 0.0f : 1.0f;
+    // --- MOB UPDATE ---
+    for (auto& mob : mMobs) mob->update(dt, mPlayer.getPosition(), mWorld);
 
-    // --- MOB UPDATE & PLAYER DAMAGE COLLISION ---
+    // Clean up corpses and drop loot
     for (auto it = mMobs.begin(); it != mMobs.end(); ) {
         auto& mob = **it;
-        mob.update(dt, mPlayer.getPosition(), mWorld, currentBrightness);
-
-        if (!mob.isDead() && mob.getBounds().intersects(mPlayer.getGlobalBounds())) {
-            float dir = (mPlayer.getPosition().x > mob.getPosition().x) ? 1.0f : -1.0f;
-
-            // Compute Damage Reduction from Armor
-            int totalDefense = 0;
-            if (mArmorHead.id == ItemID::WOOD_HELMET) totalDefense += 2;
-            if (mArmorChest.id == ItemID::WOOD_CHEST) totalDefense += 4;
-            if (mArmorLegs.id == ItemID::WOOD_LEGS)   totalDefense += 3;
-            if (mArmorBoots.id == ItemID::WOOD_BOOTS) totalDefense += 1;
-
-            int finalDamage = std::max(1, mob.getDamage() - totalDefense); // Minimum 1 damage
-
-            // We pass the reduced damage to the player!
-            if (mPlayer.takeDamage(finalDamage, dir)) {
-                mSndHit.setPitch(0.7f);
-                mSndHit.play();
-                std::cout << "Golpe recibido! Daño original: " << mob.getDamage()
-                          << " | Bloqueado: " << totalDefense
-                          << " | Daño final: " << finalDamage << std::endl;
-
-                // --- ¡NUEVO! PROBABILIDAD DE SANGRADO ---
-                // Si el ataque te hizo más de 5 de daño (no lo paró tu armadura del todo)
-                // y es de noche (probabilidad más alta con bichos peligrosos)
-                if (finalDamage > 5 && (rand() % 100) < 30) { // 30% de probabilidad
-                    mPlayer.applyBleeding(6.0f); // 6 segundos de sangrado
-                    std::cout << "[ESTADO] ¡Estás sangrando! Busca curación." << std::endl;
-                }
-            }
-        }
-
-        // Clean up corpses and drop loot
         if (mob.isDead()) {
             mWorld.spawnItem(ItemID::MEAT, mob.getPosition()); // ¡Cambiado 50 por ItemID::MEAT!
             mSndBreak.setPitch(1.5f);
@@ -1265,16 +1102,43 @@ void Game::update(sf::Time dt) {
             ++it;
         }
     }
+    rebuildMobGrid();
+
+    // --- PLAYER DAMAGE COLLISION ---
+    mMobGrid.queryRect(mPlayer.getGlobalBounds(), mMobQuery);
+    for (size_t id : mMobQuery) {
+        auto& mob = *mMobs[id];
+        float dir = (mPlayer.getPosition().x > mob.getPosition().x) ? 1.0f : -1.0f;
+
+        // Compute Damage Reduction from Armor
+        int totalDefense = 0;
+        if (mArmorHead.id == ItemID::WOOD_HELMET) totalDefense += 2;
+        if (mArmorChest.id == ItemID::WOOD_CHEST) totalDefense += 4;
+        if (mArmorLegs.id == ItemID::WOOD_LEGS)   totalDefense += 3;
+        if (mArmorBoots.id == ItemID::WOOD_BOOTS) totalDefense += 1;
+
+        int finalDamage = std::max(1, mob.getDamage() - totalDefense); // Minimum 1 damage
+
+        // We pass the reduced damage to the player!
+        if (mPlayer.takeDamage(finalDamage, dir)) {
+            mSndHit.setPitch(0.7f);
+            mSndHit.play();
+            std::cout << "Golpe recibido! Daño original: " << mob.getDamage()
+                      << " | Bloqueado: " << totalDefense
+                      << " | Daño final: " << finalDamage << std::endl;
+
+            // --- ¡NUEVO! PROBABILIDAD DE SANGRADO ---
+            // Si el ataque te hizo más de 5 de daño (no lo paró tu armadura del todo)
+            // y es de noche (probabilidad más alta con bichos peligrosos)
+            if (finalDamage > 5 && (rand() % 100) < 30) { // 30% de probabilidad
+                mPlayer.applyBleeding(6.0f); // 6 segundos de sangrado
+                std::cout << "[ESTADO] ¡Estás sangrando! Busca curación." << std::endl;
+            }
+        }
+    }
 
     // --- PARTICLE PHYSICS UPDATE ---
-    for (auto it = mParticles.begin(); it != mParticles.end(); ) {
-        it->velocity.y += 1200.0f * dt.asSeconds(); // Gravity
-        it->position += it->velocity * dt.asSeconds();
-        it->lifetime -= dt.asSeconds();
-
-        if (it->lifetime <= 0.0f) it = mParticles.erase(it);
-        else ++it;
-    }
+    mParticles.update(dt.asSeconds(), 1200.0f); // Gravity
 
     // --- PROJECTILE PHYSICS UPDATE ---
     for (auto it = mProjectiles.begin(); it != mProjectiles.end(); ) {
@@ -1282,18 +1146,29 @@ void Game::update(sf::Time dt) {
         proj.update(dt, mWorld);
 
         if (!proj.isDead()) {
-            for (auto& mob : mMobs) {
-                if (!mob->isDead() && proj.getBounds().intersects(mob->getBounds())) {
-                    float dir = (proj.getVelocity().x > 0) ? 1.0f : -1.0f;
-                    if (mob->takeDamage(proj.getDamage(), dir)) {
-                        mSndHit.setPitch(1.2f);
-                        mSndHit.play();
-                        spawnParticles(mob->getPosition(), ItemID::MEAT, 10);
-                        proj.kill();
-                        break;
-                    }
+            // Swept test: the first mob along this step's path (which already ends at any wall)
+            Mob* target = nullptr;
+            float targetTime = 2.0f;
+            mMobGrid.queryRect(proj.getPathBounds(), mMobQuery);
+            for (size_t id : mMobQuery) {
+                Mob* mob = mMobs[id].get();
+                float time;
+                if (!mob->isDead() && proj.sweepHits(mob->getBounds(), time) && time < targetTime) {
+                    target = mob;
+                    targetTime = time;
                 }
             }
+
+            if (target) {
+                float dir = (proj.getVelocity().x > 0) ? 1.0f : -1.0f;
+                if (target->takeDamage(proj.getDamage(), dir)) {
+                    mSndHit.setPitch(1.2f);
+                    mSndHit.play();
+                    spawnParticles(target->getPosition(), ItemID::MEAT, 10);
+                    proj.kill();
+                }
+            }
+            if (!proj.isDead() && proj.hasHitWall()) proj.stickInWall(mWorld);
         }
 
         if (proj.isDead()) it = mProjectiles.erase(it);
@@ -1365,16 +1240,11 @@ void Game::render() {
             }
             mWindow.draw(mSkySprite);
 
-            mWorld.render(mWindow, mAmbientLight);
+            mWorld.render(mWindow);
+            mWorld.renderLighting(mWindow, mAmbientLight);
 
-            // Draw meteor trail particles
-            sf::RectangleShape pShape;
-            for (const auto& p : mParticles) {
-                pShape.setSize(sf::Vector2f(p.size, p.size));
-                pShape.setPosition(p.position);
-                pShape.setFillColor(p.color);
-                mWindow.draw(pShape);
-            }
+            // Draw meteor trail particles (glowing: drawn after the lighting pass)
+            mParticles.draw(mWindow);
 
             mCapsuleSprite.setPosition(mCapsulePos);
             mWindow.draw(mCapsuleSprite);
@@ -1383,38 +1253,11 @@ void Game::render() {
     else {
         mWindow.clear(mAmbientLight);
 
-        // ==========================================
-        // DYNAMIC LIGHTING CALCULATION (Cave System)
-        // ==========================================
+        // The scene is drawn unlit; World::renderLighting multiplies the
+        // lightmap (skylight per column + torch light) over it at the end
         sf::Color skyLight = mAmbientLight;
-        sf::Vector2f centerPos = mPlayer.getCenter();
-        int pGridX = static_cast<int>(centerPos.x / mWorld.getTileSize());
-        int pGridY = static_cast<int>(centerPos.y / mWorld.getTileSize());
-
-        // Approximate surface height using nearby column samples
-        float accumulatedSurfaceY = 0.0f;
-        int columnsChecked = 0;
-        int range = 10;
-        for (int x = pGridX - range; x <= pGridX + range; ++x) {
-            for (int y = 0; y < WORLD_HEIGHT; ++y) {
-                if (mWorld.getBlock(x, y) != 0) {
-                    accumulatedSurfaceY += y;
-                    columnsChecked++;
-                    break;
-                }
-            }
-        }
-
-        float averageSurfaceY = (columnsChecked > 0) ? (accumulatedSurfaceY / columnsChecked) : pGridY;
-        float depth = pGridY - averageSurfaceY;
-        float caveFactor = std::clamp(depth / 20.0f, 0.0f, 1.0f); // Darken progressively over 20 blocks down
 
-        sf::Uint8 r = static_cast<sf::Uint8>(std::max(5.0f, skyLight.r * (1.0f - caveFactor)));
-        sf::Uint8 g = static_cast<sf::Uint8>(std::max(5.0f, skyLight.g * (1.0f - caveFactor)));
-        sf::Uint8 b = static_cast<sf::Uint8>(std::max(5.0f, skyLight.b * (1.0f - caveFactor)));
-        sf::Color finalAmbient(r, g, b);
-
-        // DRAW SKY
+        // DRAW SKY (tinted by the lighting pass like everything else)
         sf::View currentView = mWindow.getView();
         mSkySprite.setPosition(currentView.getCenter().x - currentView.getSize().x / 2.0f,
                                currentView.getCenter().y - currentView.getSize().y / 2.0f);
@@ -1422,56 +1265,22 @@ void Game::render() {
             mSkySprite.setScale(currentView.getSize().x / mSkyTexture.getSize().x,
                                 currentView.getSize().y / mSkyTexture.getSize().y);
         }
-        mSkySprite.setColor(skyLight);
         mWindow.draw(mSkySprite);
 
-        // Calculate Torch Influence on Player
-        sf::Color playerColor = finalAmbient;
-        float lightRadius = 250.0f;
-        float maxTorchIntensity = 0.0f;
-
-        for (int x = pGridX - 10; x <= pGridX + 10; ++x) {
-            for (int y = pGridY - 10; y <= pGridY + 10; ++y) {
-                if (mWorld.getBlock(x, y) == ItemID::TORCH) {
-                    float torchX = x * mWorld.getTileSize() + mWorld.getTileSize()/2.0f;
-                    float torchY = y * mWorld.getTileSize() + mWorld.getTileSize()/2.0f;
-                    float dist = std::sqrt(std::pow(centerPos.x - torchX, 2) + std::pow(centerPos.y - torchY, 2));
-                    if (dist < lightRadius) {
-                        maxTorchIntensity = std::max(maxTorchIntensity, 1.0f - (dist / lightRadius));
-                    }
-                }
-            }
-        }
+        // DRAW WORLD & ENTITIES
+        mWorld.render(mWindow);
 
-        float baseR = std::max(playerColor.r / 255.0f, maxTorchIntensity);
-        float baseG = std::max(playerColor.g / 255.0f, maxTorchIntensity);
-        float baseB = std::max(playerColor.b / 255.0f, maxTorchIntensity);
-        playerColor.r = static_cast<sf::Uint8>(std::min(255.0f, baseR * 255.0f));
-        playerColor.g = static_cast<sf::Uint8>(std::min(255.0f, baseG * 255.0f));
-        playerColor.b = static_cast<sf::Uint8>(std::min(255.0f, baseB * 255.0f));
+        // Player layers, mobs and projectiles are sorted by layer and texture: one draw per texture
+        mPlayer.render(mSpriteBatch);
+        for (auto& mob : mMobs) mob->render(mSpriteBatch);
+        for (auto& proj : mProjectiles) proj->render(mSpriteBatch);
+        mSpriteBatch.flush(mWindow);
 
-        // DRAW WORLD & ENTITIES
-        mWorld.render(mWindow, finalAmbient);
-        mPlayer.render(mWindow, playerColor);
-
-        for (auto& mob : mMobs) mob->render(mWindow, finalAmbient);
-        for (auto& proj : mProjectiles) proj->render(mWindow, finalAmbient);
-
-        // DRAW PARTICLES (Fading and darkened by ambient light)
-        sf::RectangleShape pShape;
-        for (const auto& p : mParticles) {
-            pShape.setSize(sf::Vector2f(p.size, p.size));
-            pShape.setPosition(p.position);
-
-            sf::Color c = p.color;
-            c.a = static_cast<sf::Uint8>(255.0f * (p.lifetime / p.maxLifetime));
-            c.r = (c.r * finalAmbient.r) / 255;
-            c.g = (c.g * finalAmbient.g) / 255;
-            c.b = (c.b * finalAmbient.b) / 255;
-
-            pShape.setFillColor(c);
-            mWindow.draw(pShape);
-        }
+        // DRAW PARTICLES (Fading, one batched draw)
+        mParticles.draw(mWindow);
+
+        // LIGHTING PASS (one multiplicative draw over the whole scene)
+        mWorld.renderLighting(mWindow, skyLight);
 
         // DRAW UI
         if (mIsPlayerDead) {
@@ -1481,6 +1290,8 @@ void Game::render() {
             renderMenus();
         }
 
+        if (mShowDebugOverlay) renderDebugOverlay();
+
         // PAUSE OVERLAY
         if (mGameState == GameState::Paused) {
             mWindow.setView(mWindow.getDefaultView());
@@ -1571,40 +1382,55 @@ void Game::loadGame() {
         return;
     }
 
+    // Sections 1-4 are read into locals and applied only once the world section
+    // is accepted, so a save from an older build leaves the current game intact
+
     // 1. Player Position
     sf::Vector2f pos;
     file.read(reinterpret_cast<char*>(&pos), sizeof(pos));
-    mPlayer.setPosition(pos);
 
     // 2. Backpack
     size_t backpackSize = 0;
     file.read(reinterpret_cast<char*>(&backpackSize), sizeof(backpackSize));
-    mBackpack.resize(backpackSize);
+    if (!file || backpackSize > 1024) { // The backpack has 30 slots; anything huge is garbage
+        std::cerr << "Error: Save file is corrupt or from an older version." << std::endl;
+        return;
+    }
+    std::vector<InventorySlot> backpack(backpackSize);
     for (size_t i = 0; i < backpackSize; ++i) {
-        int id = 0, count = 0;
-        file.read(reinterpret_cast<char*>(&id), sizeof(id));
-        file.read(reinterpret_cast<char*>(&count), sizeof(count));
-        mBackpack[i].id = id;
-        mBackpack[i].count = count;
+        file.read(reinterpret_cast<char*>(&backpack[i].id), sizeof(backpack[i].id));
+        file.read(reinterpret_cast<char*>(&backpack[i].count), sizeof(backpack[i].count));
     }
 
     // 3. Hotbar
-    InventorySlot* equippedPointers[4] = { &mEquippedPrimary, &mEquippedSecondary, &mEquippedBlock, &mEquippedConsumable };
+    InventorySlot equipped[4];
     for (int i = 0; i < 4; ++i) {
-        file.read(reinterpret_cast<char*>(&equippedPointers[i]->id), sizeof(equippedPointers[i]->id));
-        file.read(reinterpret_cast<char*>(&equippedPointers[i]->count), sizeof(equippedPointers[i]->count));
+        file.read(reinterpret_cast<char*>(&equipped[i].id), sizeof(equipped[i].id));
+        file.read(reinterpret_cast<char*>(&equipped[i].count), sizeof(equipped[i].count));
     }
 
     // 4. Armor
-    InventorySlot* armorToLoad[4] = { &mArmorHead, &mArmorChest, &mArmorLegs, &mArmorBoots };
+    InventorySlot armor[4];
     for (int i = 0; i < 4; ++i) {
-        file.read(reinterpret_cast<char*>(&armorToLoad[i]->id), sizeof(armorToLoad[i]->id));
-        file.read(reinterpret_cast<char*>(&armorToLoad[i]->count), sizeof(armorToLoad[i]->count));
+        file.read(reinterpret_cast<char*>(&armor[i].id), sizeof(armor[i].id));
+        file.read(reinterpret_cast<char*>(&armor[i].count), sizeof(armor[i].count));
     }
-    mPlayer.setEquippedWeapon(0); // Safely reset active hand
 
     // 5. Chunk Data
-    mWorld.loadFromStream(file);
+    if (!file || !mWorld.loadFromStream(file)) {
+        std::cerr << "Error: Save file is corrupt or from an older version; keeping the current game." << std::endl;
+        return;
+    }
+
+    mPlayer.setPosition(pos);
+    mBackpack = backpack;
+    InventorySlot* equippedPointers[4] = { &mEquippedPrimary, &mEquippedSecondary, &mEquippedBlock, &mEquippedConsumable };
+    InventorySlot* armorPointers[4] = { &mArmorHead, &mArmorChest, &mArmorLegs, &mArmorBoots };
+    for (int i = 0; i < 4; ++i) {
+        *equippedPointers[i] = equipped[i];
+        *armorPointers[i] = armor[i];
+    }
+    mPlayer.setEquippedWeapon(0); // Safely reset active hand
 
     // 6. Furnaces
     mActiveFurnaces.clear();
@@ -1636,6 +1462,7 @@ void Game::loadGame() {
     }
 
     file.close();
+    invalidateMenus();
     std::cout << "--- GAME LOADED ---" << std::endl;
 }
 
@@ -1647,16 +1474,16 @@ void Game::calculateTotalWeight() {
     mCurrentWeight = 0.0f;
 
     for (const auto& slot : mBackpack) {
-        if (slot.id != 0) mCurrentWeight += mItemDatabase[slot.id].weight * slot.count;
+        if (slot.id != 0) mCurrentWeight += itemProperties(slot.id).weight * slot.count;
     }
 
     InventorySlot* wheel[4] = { &mEquippedPrimary, &mEquippedSecondary, &mEquippedBlock, &mEquippedConsumable };
     for (int i = 0; i < 4; ++i) {
-        if (wheel[i]->id != 0) mCurrentWeight += mItemDatabase[wheel[i]->id].weight * wheel[i]->count;
+        if (wheel[i]->id != 0) mCurrentWeight += itemProperties(wheel[i]->id).weight * wheel[i]->count;
     }
 
     if (mDraggedItem.id != 0) {
-        mCurrentWeight += mItemDatabase[mDraggedItem.id].weight * mDraggedItem.count;
+        mCurrentWeight += itemProperties(mDraggedItem.id).weight * mDraggedItem.count;
     }
 
     if (std::abs(mCurrentWeight - oldWeight) > 0.01f) {
@@ -1669,11 +1496,13 @@ void Game::calculateTotalWeight() {
  * @return True if all items were successfully stored.
  */
 bool Game::addItemToBackpack(int id, int amount) {
+    invalidateMenus();
+
     // 1. Try stacking in Tactical Wheel
     InventorySlot* wheel[4] = { &mEquippedConsumable, &mEquippedBlock, &mEquippedSecondary, &mEquippedPrimary };
     for (int i = 0; i < 4; ++i) {
-        if (wheel[i]->id == id && wheel[i]->count < mItemDatabase[id].maxStack) {
-            int space = mItemDatabase[id].maxStack - wheel[i]->count;
+        if (wheel[i]->id == id && wheel[i]->count < itemProperties(id).maxStack) {
+            int space = itemProperties(id).maxStack - wheel[i]->count;
             if (amount <= space) {
                 wheel[i]->count += amount;
                 calculateTotalWeight();
@@ -1688,8 +1517,8 @@ bool Game::addItemToBackpack(int id, int amount) {
     // 2. Try stacking in Armor Wheel
     InventorySlot* armor[4] = { &mArmorHead, &mArmorChest, &mArmorLegs, &mArmorBoots };
     for (int i = 0; i < 4; ++i) {
-        if (armor[i]->id == id && armor[i]->count < mItemDatabase[id].maxStack) {
-            int space = mItemDatabase[id].maxStack - armor[i]->count;
+        if (armor[i]->id == id && armor[i]->count < itemProperties(id).maxStack) {
+            int space = itemProperties(id).maxStack - armor[i]->count;
             if (amount <= space) {
                 armor[i]->count += amount;
                 calculateTotalWeight();
@@ -1703,8 +1532,8 @@ bool Game::addItemToBackpack(int id, int amount) {
 
     // 3. Try stacking in Backpack
     for (auto& slot : mBackpack) {
-        if (slot.id == id && slot.count < mItemDatabase[id].maxStack) {
-            int space = mItemDatabase[id].maxStack - slot.count;
+        if (slot.id == id && slot.count < itemProperties(id).maxStack) {
+            int space = itemProperties(id).maxStack - slot.count;
             if (amount <= space) {
                 slot.count += amount;
                 calculateTotalWeight();
@@ -1720,13 +1549,13 @@ bool Game::addItemToBackpack(int id, int amount) {
     for (auto& slot : mBackpack) {
         if (slot.id == ItemID::AIR) {
             slot.id = id;
-            if (amount <= mItemDatabase[id].maxStack) {
+            if (amount <= itemProperties(id).maxStack) {
                 slot.count = amount;
                 calculateTotalWeight();
                 return true;
             } else {
-                slot.count = mItemDatabase[id].maxStack;
-                amount -= mItemDatabase[id].maxStack;
+                slot.count = itemProperties(id).maxStack;
+                amount -= itemProperties(id).maxStack;
             }
         }
     }
@@ -1747,6 +1576,7 @@ int Game::getItemCount(int id) {
 
 bool Game::consumeItem(int id, int amount) {
     if (getItemCount(id) < amount) return false;
+    invalidateMenus();
 
     int remaining = amount;
 
@@ -1810,15 +1640,10 @@ void Game::respawnPlayer() {
     // Spawn point is fixed at column X = 100
     int gridX = 100;
     float spawnX = gridX * mWorld.getTileSize();
-    float spawnY = 0.0f;
 
-    // Scan downward for the surface
-    for (int y = 0; y < WORLD_HEIGHT; ++y) {
-        if (mWorld.getBlock(gridX, y) != 0) {
-            spawnY = (y - 2) * mWorld.getTileSize();
-            break;
-        }
-    }
+    // Scans the real blocks when the spawn column is in memory (player builds
+    // count); otherwise the heightmap stage is enough to find the ground
+    float spawnY = (mWorld.getSurfaceHeight(gridX) - 2) * mWorld.getTileSize();
 
     mPlayer.setPosition(sf::Vector2f(spawnX, spawnY));
     mCameraPos = sf::Vector2f(spawnX, spawnY); // Snap camera to avoid dizzying sweep
@@ -1844,6 +1669,7 @@ bool Game::interactWithBlock(int gridX, int gridY) {
         mIsCraftingTableOpen = !mIsCraftingTableOpen;
         mIsFurnaceOpen = false;
         mIsInventoryOpen = mIsCraftingTableOpen;
+        invalidateMenus();
         return true;
     }
 
@@ -1852,6 +1678,7 @@ bool Game::interactWithBlock(int gridX, int gridY) {
         mIsInventoryOpen = mIsFurnaceOpen;
         mIsCraftingTableOpen = false;
         if (mIsFurnaceOpen) mOpenFurnacePos = {gridX, gridY};
+        invalidateMenus();
         return true;
     }
 
@@ -1888,6 +1715,7 @@ bool Game::interactWithBlock(int gridX, int gridY) {
                 mActiveChests[mOpenChestPos] = ChestData();
             }
         }
+        invalidateMenus();
         return true;
     }
 
@@ -1935,7 +1763,24 @@ void Game::updateDayNightCycle(float dtAsSeconds) {
     mAmbientLight.r = startColor.r + (targetColor.r - startColor.r) * lerpFactor;
     mAmbientLight.g = startColor.g + (targetColor.g - startColor.g) * lerpFactor;
     mAmbientLight.b = startColor.b + (targetColor.b - startColor.b) * lerpFactor;
-    mSkySprite.setColor(mAmbientLight);
+}
+
+/**
+ * @brief Draws an item icon. Every icon comes from the same atlas page, so
+ * consecutive icons never switch textures.
+ */
+bool Game::drawItemIcon(sf::RenderTarget& target, int id, sf::Vector2f position, float width, sf::Color color, bool centered) {
+    TextureAtlas::Region region = mWorld.getItemRegion(id);
+    if (!region.texture) return false;
+
+    sf::Sprite icon(*region.texture, region.rect);
+    float scale = width / region.rect.width;
+    icon.setScale(scale, scale);
+    if (centered) icon.setOrigin(region.rect.width / 2.0f, region.rect.height / 2.0f);
+    icon.setPosition(position);
+    icon.setColor(color);
+    target.draw(icon);
+    return true;
 }
 
 /**
@@ -1982,6 +1827,10 @@ void Game::renderHUD() {
     sf::View currentView = mWindow.getView();
     mWindow.setView(mWindow.getDefaultView());
 
+    // Drawn directly: a slot and a row of hearts cost less than blitting a
+    // window-sized cached layer every frame
+    InventorySlot* wheel[4] = { &mEquippedConsumable, &mEquippedBlock, &mEquippedSecondary, &mEquippedPrimary };
+
     // Active Item Display
     float uiX = 240.0f, uiY = 70.0f, slotSize = 40.0f;
     sf::RectangleShape activeSlotBg(sf::Vector2f(slotSize, slotSize));
@@ -1992,15 +1841,8 @@ void Game::renderHUD() {
     mWindow.draw(activeSlotBg);
 
     if (mSelectedBlock != ItemID::AIR) {
-        const sf::Texture* tex = mWorld.getTexture(mSelectedBlock);
-        if (tex != nullptr) {
-            sf::Sprite icon(*tex);
-            float scale = (slotSize - 10.0f) / tex->getSize().x;
-            icon.setScale(scale, scale);
-            icon.setPosition(uiX + 5.0f, uiY + 5.0f);
-            mWindow.draw(icon);
-
-            InventorySlot* wheel[4] = { &mEquippedConsumable, &mEquippedBlock, &mEquippedSecondary, &mEquippedPrimary };
+        if (drawItemIcon(mWindow, mSelectedBlock, sf::Vector2f(uiX + 5.0f, uiY + 5.0f), slotSize - 10.0f)) {
+
             if (wheel[mActiveWheelSlot]->count > 0) {
                 mUiText.setString(std::to_string(wheel[mActiveWheelSlot]->count));
                 mUiText.setCharacterSize(14);
@@ -2026,293 +1868,311 @@ void Game::renderHUD() {
 }
 
 /**
- * @brief Renders the interactive UI overlays (Inventory, Crafting, Chests, Furnaces).
+ * @brief Renders engine counters in the top-right corner (toggled with F3).
  */
-void Game::renderMenus() {
-    if (mIsInventoryOpen || mIsFurnaceOpen) {
-        sf::View uiView(sf::FloatRect(0.0f, 0.0f, static_cast<float>(mWindow.getSize().x), static_cast<float>(mWindow.getSize().y)));
-        mWindow.setView(uiView);
-        sf::RectangleShape overlay(sf::Vector2f(mWindow.getSize().x, mWindow.getSize().y));
-        overlay.setFillColor(sf::Color(0, 0, 0, 150));
-        mWindow.draw(overlay);
-    }
-
-    // Furnace Menu
-    if (mIsFurnaceOpen) {
-        mWindow.setView(mWindow.getDefaultView());
-        float scale = 6.0f;
-        mFurnaceBgSprite.setScale(scale, scale);
-
-        float bgX = (mWindow.getSize().x - mFurnaceBgTex.getSize().x * scale) / 2.0f;
-        float bgY = (mWindow.getSize().y - mFurnaceBgTex.getSize().y * scale) / 2.0f;
-        mFurnaceBgSprite.setPosition(bgX, bgY);
-        mWindow.draw(mFurnaceBgSprite);
+void Game::renderDebugOverlay() {
+    sf::View currentView = mWindow.getView();
+    mWindow.setView(mWindow.getDefaultView());
 
-        float firePercent = mActiveFurnaces[mOpenFurnacePos].maxFuelTimer > 0.0f ? std::clamp(mActiveFurnaces[mOpenFurnacePos].fuelTimer / mActiveFurnaces[mOpenFurnacePos].maxFuelTimer, 0.0f, 1.0f) : 0.0f;
-        float arrowPercent = std::clamp(mActiveFurnaces[mOpenFurnacePos].smeltTimer / 3.0f, 0.0f, 1.0f);
+    char line[128];
+    std::string text;
+
+    std::snprintf(line, sizeof(line), "Seed: %llu\n", static_cast<unsigned long long>(mWorld.getSeed()));
+    text += line;
+    std::snprintf(line, sizeof(line), "Chunks resident: %zu / %zu\n",
+                  mWorld.getResidentChunkCount(), mWorld.getResidentChunkBudget());
+    text += line;
+    std::snprintf(line, sizeof(line), "Chunks on disk: %zu\n", mWorld.getSpilledChunkCount());
+    text += line;
+    std::snprintf(line, sizeof(line), "Evictions: %zu (%.1f/s)\n",
+                  mWorld.getEvictionCount(), mWorld.getEvictionRate());
+    text += line;
+    std::snprintf(line, sizeof(line), "Worldgen: %zu queued, %zu async, %zu sync, %zu partial\n",
+                  mWorld.getQueuedChunkCount(), mWorld.getAsyncGeneratedCount(), mWorld.getSyncGeneratedCount(),
+                  mWorld.getPartialGeneratedCount());
+    text += line;
+    std::snprintf(line, sizeof(line), "Draw calls (world): %zu\n", mWorld.getDrawCallCount());
+    text += line;
+    std::snprintf(line, sizeof(line), "Draw calls (sprites): %zu\n", mSpriteBatch.getDrawCallCount());
+    text += line;
+
+    mUiText.setString(text);
+    mUiText.setCharacterSize(16);
+    sf::FloatRect bounds = mUiText.getLocalBounds();
+    mUiText.setPosition(mWindow.getDefaultView().getSize().x - bounds.width - 20.0f, 20.0f);
+
+    sf::RectangleShape background(sf::Vector2f(bounds.width + 20.0f, bounds.height + 20.0f));
+    background.setPosition(mUiText.getPosition().x - 10.0f, 10.0f);
+    background.setFillColor(sf::Color(0, 0, 0, 150));
+    mWindow.draw(background);
+    mWindow.draw(mUiText);
 
-        int fireHeight = static_cast<int>(9 * firePercent);
-        int fireTexY = 26 + (9 - fireHeight);
-        mFurnaceFireSprite.setTextureRect(sf::IntRect(39, fireTexY, 6, fireHeight));
-        mFurnaceFireSprite.setScale(scale, scale);
-        mFurnaceFireSprite.setPosition(bgX + (39 * scale), bgY + (fireTexY * scale));
-        mWindow.draw(mFurnaceFireSprite);
-
-        int arrowWidth = static_cast<int>(22 * arrowPercent);
-        mFurnaceArrowSprite.setTextureRect(sf::IntRect(53, 24, arrowWidth, 13));
-        mFurnaceArrowSprite.setScale(scale, scale);
-        mFurnaceArrowSprite.setPosition(bgX + (53 * scale), bgY + (24 * scale));
-        mWindow.draw(mFurnaceArrowSprite);
-
-        auto drawFurnaceSlot = [&](InventorySlot& slot, float startX, float startY) {
-            if (slot.id != ItemID::AIR && slot.count > 0) {
-                sf::Sprite itemSprite(*mWorld.getTexture(slot.id));
-                itemSprite.setScale(1.5f, 1.5f);
-                itemSprite.setPosition(bgX + (startX * scale) + 5.0f, bgY + (startY * scale) + 5.0f);
-                mWindow.draw(itemSprite);
-
-                sf::Text countText(std::to_string(slot.count), *mDeathTitleText.getFont(), 16);
-                countText.setOutlineColor(sf::Color::Black);
-                countText.setOutlineThickness(1.5f);
-                countText.setPosition(bgX + (startX * scale) + 20.0f, bgY + (startY * scale) + 20.0f);
-                mWindow.draw(countText);
-            }
-        };
+    mWindow.setView(currentView);
+}
 
-        drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].input, 34.0f, 13.0f);
-        drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].fuel, 34.0f, 37.0f);
-        drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].output, 82.0f, 22.0f);
-    }
+/**
+ * @brief Renders the interactive UI overlays (Inventory, Crafting, Chests, Furnaces).
+ * Everything that only changes with inventory, chest, furnace or recipe state is
+ * cached in mMenuPanel; the furnace fire and progress arrow and the dragged item
+ * are drawn live on top of it.
+ */
+void Game::renderMenus() {
+    if (!mIsInventoryOpen && !mIsFurnaceOpen) return;
 
-    if (mIsInventoryOpen) {
-        sf::View uiView(sf::FloatRect(0.0f, 0.0f, static_cast<float>(mWindow.getSize().x), static_cast<float>(mWindow.getSize().y)));
-        mWindow.setView(uiView);
+    sf::Vector2u windowSize = mWindow.getSize();
+    sf::View uiView(sf::FloatRect(0.0f, 0.0f, static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+    mWindow.setView(uiView);
 
-        float slotSize = 48.0f, padding = 8.0f;
-        float startX = (mWindow.getSize().x / 2.0f) - ((10 * slotSize + 9 * padding) / 2.0f);
-        float startY = mWindow.getSize().y - (3 * slotSize + 2 * padding) - 50.0f;
+    // Furnace panel placement (shared by the cached slots and the live gauges)
+    float furnaceScale = 6.0f;
+    float bgX = (windowSize.x - mFurnaceBgTex.getSize().x * furnaceScale) / 2.0f;
+    float bgY = (windowSize.y - mFurnaceBgTex.getSize().y * furnaceScale) / 2.0f;
 
-        // A) Backpack Grid
-        for (int row = 0; row < 3; ++row) {
-            for (int col = 0; col < 10; ++col) {
-                int index = row * 10 + col;
-                sf::RectangleShape slotBg(sf::Vector2f(slotSize, slotSize));
-                slotBg.setPosition(startX + col * (slotSize + padding), startY + row * (slotSize + padding));
-                slotBg.setFillColor(sf::Color(40, 40, 40, 200));
-                slotBg.setOutlineThickness(2.0f);
-                slotBg.setOutlineColor(sf::Color(100, 100, 100));
-                mWindow.draw(slotBg);
+    if (mMenuPanel.beginUpdate(windowSize)) {
+        sf::RenderTarget& target = mMenuPanel.getTarget();
 
-                if (mBackpack[index].id != ItemID::AIR) {
-                    const sf::Texture* tex = mWorld.getTexture(mBackpack[index].id);
-                    if (tex) {
-                        sf::Sprite icon(*tex);
-                        float scale = (slotSize - 10.0f) / tex->getSize().x;
-                        icon.setScale(scale, scale);
-                        icon.setPosition(slotBg.getPosition().x + 5.0f, slotBg.getPosition().y + 5.0f);
-                        mWindow.draw(icon);
-
-                        mUiText.setString(std::to_string(mBackpack[index].count));
-                        mUiText.setCharacterSize(14);
-                        sf::FloatRect textBounds = mUiText.getLocalBounds();
-                        mUiText.setPosition(slotBg.getPosition().x + slotSize - textBounds.width - 4.0f,
-                                            slotBg.getPosition().y + slotSize - textBounds.height - 6.0f);
-                        mWindow.draw(mUiText);
+        sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
+        overlay.setFillColor(sf::Color(0, 0, 0, 150));
+        target.draw(overlay);
+
+        // Furnace Menu
+        if (mIsFurnaceOpen) {
+            mFurnaceBgSprite.setScale(furnaceScale, furnaceScale);
+            mFurnaceBgSprite.setPosition(bgX, bgY);
+            target.draw(mFurnaceBgSprite);
+
+            auto drawFurnaceSlot = [&](InventorySlot& slot, float startX, float startY) {
+                if (slot.id != ItemID::AIR && slot.count > 0) {
+                    float iconWidth = mWorld.getItemRegion(slot.id).rect.width * 1.5f;
+                    drawItemIcon(target, slot.id, sf::Vector2f(bgX + (startX * furnaceScale) + 5.0f, bgY + (startY * furnaceScale) + 5.0f), iconWidth);
+
+                    sf::Text countText(std::to_string(slot.count), *mDeathTitleText.getFont(), 16);
+                    countText.setOutlineColor(sf::Color::Black);
+                    countText.setOutlineThickness(1.5f);
+                    countText.setPosition(bgX + (startX * furnaceScale) + 20.0f, bgY + (startY * furnaceScale) + 20.0f);
+                    target.draw(countText);
+                }
+            };
+
+            drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].input, 34.0f, 13.0f);
+            drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].fuel, 34.0f, 37.0f);
+            drawFurnaceSlot(mActiveFurnaces[mOpenFurnacePos].output, 82.0f, 22.0f);
+        }
+
+        if (mIsInventoryOpen) {
+            float slotSize = 48.0f, padding = 8.0f;
+            float startX = (windowSize.x / 2.0f) - ((10 * slotSize + 9 * padding) / 2.0f);
+            float startY = windowSize.y - (3 * slotSize + 2 * padding) - 50.0f;
+
+            // A) Backpack Grid
+            for (int row = 0; row < 3; ++row) {
+                for (int col = 0; col < 10; ++col) {
+                    int index = row * 10 + col;
+                    sf::RectangleShape slotBg(sf::Vector2f(slotSize, slotSize));
+                    slotBg.setPosition(startX + col * (slotSize + padding), startY + row * (slotSize + padding));
+                    slotBg.setFillColor(sf::Color(40, 40, 40, 200));
+                    slotBg.setOutlineThickness(2.0f);
+                    slotBg.setOutlineColor(sf::Color(100, 100, 100));
+                    target.draw(slotBg);
+
+                    if (mBackpack[index].id != ItemID::AIR) {
+                        sf::Vector2f iconPos(slotBg.getPosition().x + 5.0f, slotBg.getPosition().y + 5.0f);
+                        if (drawItemIcon(target, mBackpack[index].id, iconPos, slotSize - 10.0f)) {
+
+                            mUiText.setString(std::to_string(mBackpack[index].count));
+                            mUiText.setCharacterSize(14);
+                            sf::FloatRect textBounds = mUiText.getLocalBounds();
+                            mUiText.setPosition(slotBg.getPosition().x + slotSize - textBounds.width - 4.0f,
+                                                slotBg.getPosition().y + slotSize - textBounds.height - 6.0f);
+                            target.draw(mUiText);
+                        }
                     }
                 }
             }
-        }
 
-        // B) Tactical Wheel / Crafting
-        if (!mIsFurnaceOpen && !mIsChestOpen) {
-            float wheelCX = mWindow.getSize().x / 2.0f;
-            float wheelCY = mWindow.getSize().y / 2.0f - 100.0f;
+            // B) Tactical Wheel / Crafting
+            if (!mIsFurnaceOpen && !mIsChestOpen) {
+                float wheelCX = windowSize.x / 2.0f;
+                float wheelCY = windowSize.y / 2.0f - 100.0f;
 
-            InventorySlot* wheelSlots[4];
-            std::string wheelLabels[4];
+                InventorySlot* wheelSlots[4];
+                std::string wheelLabels[4];
 
-            if (mIsArmorWheelActive) {
-                wheelSlots[0] = &mArmorHead; wheelSlots[1] = &mArmorChest;
-                wheelSlots[2] = &mArmorLegs; wheelSlots[3] = &mArmorBoots;
-                wheelLabels[0] = "Head"; wheelLabels[1] = "Chest";
-                wheelLabels[2] = "Legs"; wheelLabels[3] = "Boots";
-                mWheelSprite.setColor(sf::Color(100, 150, 255)); // Blue tint
-            } else {
-                wheelSlots[0] = &mEquippedConsumable; wheelSlots[1] = &mEquippedBlock;
-                wheelSlots[2] = &mEquippedSecondary;  wheelSlots[3] = &mEquippedPrimary;
-                wheelLabels[0] = "Usable"; wheelLabels[1] = "Block";
-                wheelLabels[2] = "Weapon 2"; wheelLabels[3] = "Weapon 1";
-                mWheelSprite.setColor(sf::Color::White); // Normal
-            }
+                if (mIsArmorWheelActive) {
+                    wheelSlots[0] = &mArmorHead; wheelSlots[1] = &mArmorChest;
+                    wheelSlots[2] = &mArmorLegs; wheelSlots[3] = &mArmorBoots;
+                    wheelLabels[0] = "Head"; wheelLabels[1] = "Chest";
+                    wheelLabels[2] = "Legs"; wheelLabels[3] = "Boots";
+                    mWheelSprite.setColor(sf::Color(100, 150, 255)); // Blue tint
+                } else {
+                    wheelSlots[0] = &mEquippedConsumable; wheelSlots[1] = &mEquippedBlock;
+                    wheelSlots[2] = &mEquippedSecondary;  wheelSlots[3] = &mEquippedPrimary;
+                    wheelLabels[0] = "Usable"; wheelLabels[1] = "Block";
+                    wheelLabels[2] = "Weapon 2"; wheelLabels[3] = "Weapon 1";
+                    mWheelSprite.setColor(sf::Color::White); // Normal
+                }
 
-            mWheelSprite.setPosition(wheelCX, wheelCY);
-            mWindow.draw(mWheelSprite);
+                mWheelSprite.setPosition(wheelCX, wheelCY);
+                target.draw(mWheelSprite);
 
-            float offset = 100.0f;
-            sf::Vector2f wheelPositions[4] = { {0, -offset}, {0, offset}, {-offset, 0}, {offset, 0} };
-            sf::Vector2f textOffsets[4] = { {0.0f, -45.0f}, {0.0f, 25.0f}, {-45.0f, -10.0f}, {45.0f, -10.0f} };
+                float offset = 100.0f;
+                sf::Vector2f wheelPositions[4] = { {0, -offset}, {0, offset}, {-offset, 0}, {offset, 0} };
+                sf::Vector2f textOffsets[4] = { {0.0f, -45.0f}, {0.0f, 25.0f}, {-45.0f, -10.0f}, {45.0f, -10.0f} };
 
-            for (int i = 0; i < 4; ++i) {
-                float slotX = wheelCX + wheelPositions[i].x;
-                float slotY = wheelCY + wheelPositions[i].y;
+                for (int i = 0; i < 4; ++i) {
+                    float slotX = wheelCX + wheelPositions[i].x;
+                    float slotY = wheelCY + wheelPositions[i].y;
 
-                mUiText.setString(wheelLabels[i]);
-                mUiText.setCharacterSize(18);
-                mUiText.setOutlineThickness(2.0f);
-                sf::FloatRect textBounds = mUiText.getLocalBounds();
-                mUiText.setPosition(slotX + textOffsets[i].x - (textBounds.width / 2.0f), slotY + textOffsets[i].y);
-                mWindow.draw(mUiText);
+                    mUiText.setString(wheelLabels[i]);
+                    mUiText.setCharacterSize(18);
+                    mUiText.setOutlineThickness(2.0f);
+                    sf::FloatRect textBounds = mUiText.getLocalBounds();
+                    mUiText.setPosition(slotX + textOffsets[i].x - (textBounds.width / 2.0f), slotY + textOffsets[i].y);
+                    target.draw(mUiText);
+
+                    if (wheelSlots[i]->id != ItemID::AIR) {
+                        if (drawItemIcon(target, wheelSlots[i]->id, sf::Vector2f(slotX, slotY), 40.0f, sf::Color::White, true)) {
 
-                if (wheelSlots[i]->id != ItemID::AIR) {
-                    const sf::Texture* tex = mWorld.getTexture(wheelSlots[i]->id);
-                    if (tex) {
-                        sf::Sprite icon(*tex);
-                        float scale = 40.0f / tex->getSize().x;
-                        icon.setScale(scale, scale);
-                        icon.setOrigin(tex->getSize().x / 2.0f, tex->getSize().y / 2.0f);
-                        icon.setPosition(slotX, slotY);
-                        mWindow.draw(icon);
-
-                        sf::Text qtyText = mUiText;
-                        qtyText.setString(std::to_string(wheelSlots[i]->count));
-                        qtyText.setCharacterSize(14);
-                        qtyText.setPosition(slotX + 15.0f, slotY + 10.0f);
-                        mWindow.draw(qtyText);
+                            sf::Text qtyText = mUiText;
+                            qtyText.setString(std::to_string(wheelSlots[i]->count));
+                            qtyText.setCharacterSize(14);
+                            qtyText.setPosition(slotX + 15.0f, slotY + 10.0f);
+                            target.draw(qtyText);
+                        }
                     }
                 }
-            }
-
-            // Crafting List
-            float craftX = 50.0f, craftY = 100.0f, rowHeight = 60.0f, panelWidth = 320.0f;
-            mUiText.setString(mIsCraftingTableOpen ? "CRAFTING TABLE" : "MANUAL CRAFTING");
-            mUiText.setCharacterSize(24);
-            mUiText.setOutlineThickness(2.0f);
-            mUiText.setPosition(craftX, craftY - 40.0f);
-            mWindow.draw(mUiText);
 
-            int displayIndex = 0;
-            for (size_t i = 0; i < mRecipes.size(); ++i) {
-                const Recipe& recipe = mRecipes[i];
-                if (recipe.requiresTable && !mIsCraftingTableOpen) continue;
-
-                bool possible = canCraft(recipe);
-                sf::RectangleShape rowBg(sf::Vector2f(panelWidth, rowHeight - 5.0f));
-                rowBg.setPosition(craftX, craftY + displayIndex * rowHeight);
-                rowBg.setFillColor(sf::Color(40, 40, 40, 200));
-                rowBg.setOutlineThickness(possible ? 2.0f : 1.0f);
-                rowBg.setOutlineColor(possible ? sf::Color(50, 200, 50, 200) : sf::Color(100, 100, 100, 150));
-                mWindow.draw(rowBg);
-
-                const sf::Texture* resTex = mWorld.getTexture(recipe.resultId);
-                if (resTex) {
-                    sf::Sprite resIcon(*resTex);
-                    float scale = 40.0f / resTex->getSize().x;
-                    resIcon.setScale(scale, scale);
-                    resIcon.setPosition(craftX + 10.0f, craftY + displayIndex * rowHeight + 7.0f);
-                    if (!possible) resIcon.setColor(sf::Color(255, 255, 255, 100));
-                    mWindow.draw(resIcon);
-
-                    if (recipe.resultCount > 1) {
-                        mUiText.setString(std::to_string(recipe.resultCount));
-                        mUiText.setCharacterSize(16);
-                        mUiText.setFillColor(sf::Color::Yellow);
-                        mUiText.setPosition(craftX + 35.0f, craftY + displayIndex * rowHeight + 32.0f);
-                        mWindow.draw(mUiText);
-                        mUiText.setFillColor(sf::Color::White);
+                // Crafting List
+                float craftX = 50.0f, craftY = 100.0f, rowHeight = 60.0f, panelWidth = 320.0f;
+                mUiText.setString(mIsCraftingTableOpen ? "CRAFTING TABLE" : "MANUAL CRAFTING");
+                mUiText.setCharacterSize(24);
+                mUiText.setOutlineThickness(2.0f);
+                mUiText.setPosition(craftX, craftY - 40.0f);
+                target.draw(mUiText);
+
+                int displayIndex = 0;
+                for (size_t i = 0; i < mRecipes.size(); ++i) {
+                    const Recipe& recipe = mRecipes[i];
+                    if (recipe.requiresTable && !mIsCraftingTableOpen) continue;
+
+                    bool possible = canCraft(recipe);
+                    sf::RectangleShape rowBg(sf::Vector2f(panelWidth, rowHeight - 5.0f));
+                    rowBg.setPosition(craftX, craftY + displayIndex * rowHeight);
+                    rowBg.setFillColor(sf::Color(40, 40, 40, 200));
+                    rowBg.setOutlineThickness(possible ? 2.0f : 1.0f);
+                    rowBg.setOutlineColor(possible ? sf::Color(50, 200, 50, 200) : sf::Color(100, 100, 100, 150));
+                    target.draw(rowBg);
+
+                    sf::Color resColor = possible ? sf::Color::White : sf::Color(255, 255, 255, 100);
+                    if (drawItemIcon(target, recipe.resultId, sf::Vector2f(craftX + 10.0f, craftY + displayIndex * rowHeight + 7.0f), 40.0f, resColor)) {
+
+                        if (recipe.resultCount > 1) {
+                            mUiText.setString(std::to_string(recipe.resultCount));
+                            mUiText.setCharacterSize(16);
+                            mUiText.setFillColor(sf::Color::Yellow);
+                            mUiText.setPosition(craftX + 35.0f, craftY + displayIndex * rowHeight + 32.0f);
+                            target.draw(mUiText);
+                            mUiText.setFillColor(sf::Color::White);
+                        }
                     }
-                }
 
-                float ingX = craftX + 80.0f;
-                for (const auto& ing : recipe.ingredients) {
-                    const sf::Texture* ingTex = mWorld.getTexture(ing.first);
-                    if (ingTex) {
-                        sf::Sprite ingIcon(*ingTex);
-                        float scale = 24.0f / ingTex->getSize().x;
-                        ingIcon.setScale(scale, scale);
-                        ingIcon.setPosition(ingX, craftY + displayIndex * rowHeight + 15.0f);
-                        if (!possible) ingIcon.setColor(sf::Color(255, 255, 255, 150));
-                        mWindow.draw(ingIcon);
-
-                        mUiText.setString(std::to_string(getItemCount(ing.first)) + "/" + std::to_string(ing.second));
-                        mUiText.setCharacterSize(14);
-                        mUiText.setFillColor(getItemCount(ing.first) >= ing.second ? sf::Color::White : sf::Color(255, 80, 80));
-                        mUiText.setPosition(ingX + 30.0f, craftY + displayIndex * rowHeight + 18.0f);
-                        mWindow.draw(mUiText);
-                        mUiText.setFillColor(sf::Color::White);
-                        ingX += 75.0f;
+                    float ingX = craftX + 80.0f;
+                    for (const auto& ing : recipe.ingredients) {
+                        sf::Color ingColor = possible ? sf::Color::White : sf::Color(255, 255, 255, 150);
+                        if (drawItemIcon(target, ing.first, sf::Vector2f(ingX, craftY + displayIndex * rowHeight + 15.0f), 24.0f, ingColor)) {
+
+                            mUiText.setString(std::to_string(getItemCount(ing.first)) + "/" + std::to_string(ing.second));
+                            mUiText.setCharacterSize(14);
+                            mUiText.setFillColor(getItemCount(ing.first) >= ing.second ? sf::Color::White : sf::Color(255, 80, 80));
+                            mUiText.setPosition(ingX + 30.0f, craftY + displayIndex * rowHeight + 18.0f);
+                            target.draw(mUiText);
+                            mUiText.setFillColor(sf::Color::White);
+                            ingX += 75.0f;
+                        }
                     }
+                    displayIndex++;
                 }
-                displayIndex++;
             }
-        }
-
-        // C) Chest Interface
-        if (mIsChestOpen) {
-            float cSlotSize = 60.0f, cPadding = 10.0f;
-            int cols = 6, rows = 4;
-            float chestStartX = (mWindow.getSize().x - ((cols * (cSlotSize + cPadding)) + cPadding)) / 2.0f;
-            float chestStartY = (mWindow.getSize().y - ((rows * (cSlotSize + cPadding)) + cPadding)) / 2.0f - 100.0f;
-
-            mUiText.setString("CHEST");
-            mUiText.setCharacterSize(24);
-            mUiText.setPosition(chestStartX, chestStartY - 40.0f);
-            mWindow.draw(mUiText);
 
-            sf::RectangleShape chestBg(sf::Vector2f(cols * (cSlotSize + cPadding) + cPadding, rows * (cSlotSize + cPadding) + cPadding));
-            chestBg.setPosition(chestStartX - cPadding, chestStartY - cPadding);
-            chestBg.setFillColor(sf::Color(60, 40, 20, 240));
-            chestBg.setOutlineThickness(3.0f);
-            chestBg.setOutlineColor(sf::Color::Black);
-            mWindow.draw(chestBg);
-
-            ChestData& currentChest = mActiveChests[mOpenChestPos];
-            for (int i = 0; i < 24; ++i) {
-                float x = chestStartX + (i % cols) * (cSlotSize + cPadding);
-                float y = chestStartY + (i / cols) * (cSlotSize + cPadding);
-
-                sf::RectangleShape slotRect(sf::Vector2f(cSlotSize, cSlotSize));
-                slotRect.setPosition(x, y);
-                slotRect.setFillColor(sf::Color(0, 0, 0, 150));
-                slotRect.setOutlineThickness(1.0f);
-                slotRect.setOutlineColor(sf::Color(100, 100, 100));
-                mWindow.draw(slotRect);
-
-                InventorySlot& slot = currentChest.slots[i];
-                if (slot.id != ItemID::AIR) {
-                    const sf::Texture* tex = mWorld.getTexture(slot.id);
-                    if (tex) {
-                        sf::Sprite spr(*tex);
-                        float scale = (cSlotSize - 10.0f) / tex->getSize().x;
-                        spr.setScale(scale, scale);
-                        spr.setPosition(x + 5.0f, y + 5.0f);
-                        mWindow.draw(spr);
-
-                        mUiText.setString(std::to_string(slot.count));
-                        mUiText.setCharacterSize(16);
-                        mUiText.setPosition(x + cSlotSize - 20.0f, y + cSlotSize - 25.0f);
-                        mWindow.draw(mUiText);
+            // C) Chest Interface
+            if (mIsChestOpen) {
+                float cSlotSize = 60.0f, cPadding = 10.0f;
+                int cols = 6, rows = 4;
+                float chestStartX = (windowSize.x - ((cols * (cSlotSize + cPadding)) + cPadding)) / 2.0f;
+                float chestStartY = (windowSize.y - ((rows * (cSlotSize + cPadding)) + cPadding)) / 2.0f - 100.0f;
+
+                mUiText.setString("CHEST");
+                mUiText.setCharacterSize(24);
+                mUiText.setPosition(chestStartX, chestStartY - 40.0f);
+                target.draw(mUiText);
+
+                sf::RectangleShape chestBg(sf::Vector2f(cols * (cSlotSize + cPadding) + cPadding, rows * (cSlotSize + cPadding) + cPadding));
+                chestBg.setPosition(chestStartX - cPadding, chestStartY - cPadding);
+                chestBg.setFillColor(sf::Color(60, 40, 20, 240));
+                chestBg.setOutlineThickness(3.0f);
+                chestBg.setOutlineColor(sf::Color::Black);
+                target.draw(chestBg);
+
+                ChestData& currentChest = mActiveChests[mOpenChestPos];
+                for (int i = 0; i < 24; ++i) {
+                    float x = chestStartX + (i % cols) * (cSlotSize + cPadding);
+                    float y = chestStartY + (i / cols) * (cSlotSize + cPadding);
+
+                    sf::RectangleShape slotRect(sf::Vector2f(cSlotSize, cSlotSize));
+                    slotRect.setPosition(x, y);
+                    slotRect.setFillColor(sf::Color(0, 0, 0, 150));
+                    slotRect.setOutlineThickness(1.0f);
+                    slotRect.setOutlineColor(sf::Color(100, 100, 100));
+                    target.draw(slotRect);
+
+                    InventorySlot& slot = currentChest.slots[i];
+                    if (slot.id != ItemID::AIR) {
+                        if (drawItemIcon(target, slot.id, sf::Vector2f(x + 5.0f, y + 5.0f), cSlotSize - 10.0f)) {
+
+                            mUiText.setString(std::to_string(slot.count));
+                            mUiText.setCharacterSize(16);
+                            mUiText.setPosition(x + cSlotSize - 20.0f, y + cSlotSize - 25.0f);
+                            target.draw(mUiText);
+                        }
                     }
                 }
             }
         }
 
-        // D) Floating Dragged Item
-        if (mDraggedItem.id != ItemID::AIR) {
-            const sf::Texture* tex = mWorld.getTexture(mDraggedItem.id);
-            if (tex) {
-                sf::Vector2i mousePos = sf::Mouse::getPosition(mWindow);
-                sf::Sprite dragIcon(*tex);
-                float scale = 40.0f / tex->getSize().x;
-                dragIcon.setScale(scale, scale);
-                dragIcon.setOrigin(tex->getSize().x / 2.0f, tex->getSize().y / 2.0f);
-                dragIcon.setPosition(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y));
-                mWindow.draw(dragIcon);
-
-                mUiText.setString(std::to_string(mDraggedItem.count));
-                mUiText.setCharacterSize(16);
-                mUiText.setPosition(mousePos.x + 10.0f, mousePos.y + 10.0f);
-                mWindow.draw(mUiText);
-            }
+        mMenuPanel.endUpdate();
+    }
+    mMenuPanel.draw(mWindow);
+
+    // Live furnace gauges (they never overlap the cached slot icons)
+    if (mIsFurnaceOpen) {
+        const FurnaceData& furnace = mActiveFurnaces[mOpenFurnacePos];
+        float firePercent = furnace.maxFuelTimer > 0.0f ? std::clamp(furnace.fuelTimer / furnace.maxFuelTimer, 0.0f, 1.0f) : 0.0f;
+        float arrowPercent = std::clamp(furnace.smeltTimer / 3.0f, 0.0f, 1.0f);
+
+        int fireHeight = static_cast<int>(9 * firePercent);
+        int fireTexY = 26 + (9 - fireHeight);
+        mFurnaceFireSprite.setTextureRect(sf::IntRect(39, fireTexY, 6, fireHeight));
+        mFurnaceFireSprite.setScale(furnaceScale, furnaceScale);
+        mFurnaceFireSprite.setPosition(bgX + (39 * furnaceScale), bgY + (fireTexY * furnaceScale));
+        mWindow.draw(mFurnaceFireSprite);
+
+        int arrowWidth = static_cast<int>(22 * arrowPercent);
+        mFurnaceArrowSprite.setTextureRect(sf::IntRect(53, 24, arrowWidth, 13));
+        mFurnaceArrowSprite.setScale(furnaceScale, furnaceScale);
+        mFurnaceArrowSprite.setPosition(bgX + (53 * furnaceScale), bgY + (24 * furnaceScale));
+        mWindow.draw(mFurnaceArrowSprite);
+    }
+
+    // D) Floating Dragged Item (follows the mouse, always live)
+    if (mIsInventoryOpen && mDraggedItem.id != ItemID::AIR) {
+        sf::Vector2i mousePos = sf::Mouse::getPosition(mWindow);
+        sf::Vector2f dragPos(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y));
+        if (drawItemIcon(mWindow, mDraggedItem.id, dragPos, 40.0f, sf::Color::White, true)) {
+
+            mUiText.setString(std::to_string(mDraggedItem.count));
+            mUiText.setCharacterSize(16);
+            mUiText.setPosition(mousePos.x + 10.0f, mousePos.y + 10.0f);
+            mWindow.draw(mUiText);
         }
     }
 }
@@ -2343,6 +2203,7 @@ void Game::handleMouseClick(float mx, float my) {
                     mDraggedItem = mBackpack[index];
                     mBackpack[index].id = ItemID::AIR;
                     mBackpack[index].count = 0;
+                    invalidateMenus();
                     return;
                 }
             }
@@ -2373,6 +2234,7 @@ void Game::handleMouseClick(float mx, float my) {
                 wheelSlots[i]->id = ItemID::AIR;
                 wheelSlots[i]->count = 0;
                 calculateTotalWeight();
+                invalidateMenus();
                 return;
             }
         }
@@ -2405,6 +2267,7 @@ void Game::handleMouseClick(float mx, float my) {
                     mDraggedItem = slot;
                     slot.id = ItemID::AIR;
                     slot.count = 0;
+                    invalidateMenus();
                     return true;
                 }
             }
@@ -2433,6 +2296,7 @@ void Game::handleMouseClick(float mx, float my) {
                 currentChest.slots[i].id = ItemID::AIR;
                 currentChest.slots[i].count = 0;
                 calculateTotalWeight();
+                invalidateMenus();
                 return;
             }
         }
@@ -2441,6 +2305,7 @@ void Game::handleMouseClick(float mx, float my) {
 
 void Game::handleMouseRelease(float mx, float my) {
     if (mDraggedItem.id == ItemID::AIR) return;
+    invalidateMenus();
 
     float slotSize = 48.0f, padding = 8.0f;
     float startX = (mWindow.getSize().x / 2.0f) - ((10 * slotSize + 9 * padding) / 2.0f);
@@ -2498,7 +2363,7 @@ void Game::handleMouseRelease(float mx, float my) {
 
                 if (allowed) {
                     if (wheelSlots[i]->id == dragID) {
-                        int spaceLeft = mItemDatabase[dragID].maxStack - wheelSlots[i]->count;
+                        int spaceLeft = itemProperties(dragID).maxStack - wheelSlots[i]->count;
                         if (mDraggedItem.count <= spaceLeft) {
                             wheelSlots[i]->count += mDraggedItem.count;
                             mDraggedItem.id = ItemID::AIR; mDraggedItem.count = 0;
@@ -2560,7 +2425,7 @@ void Game::handleMouseRelease(float mx, float my) {
             if (sf::FloatRect(sx, sy, cSlotSize, cSlotSize).contains(mx, my)) {
                 InventorySlot& clickedSlot = currentChest.slots[i];
                 if (clickedSlot.id == mDraggedItem.id) {
-                    int spaceLeft = mItemDatabase[clickedSlot.id].maxStack - clickedSlot.count;
+                    int spaceLeft = itemProperties(clickedSlot.id).maxStack - clickedSlot.count;
                     if (mDraggedItem.count <= spaceLeft) {
                         clickedSlot.count += mDraggedItem.count;
                         mDraggedItem.id = ItemID::AIR; mDraggedItem.count = 0;
@@ -2584,42 +2449,33 @@ void Game::handleMouseRelease(float mx, float my) {
         if (!addItemToBackpack(mDraggedItem.id, mDraggedItem.count)) {
             int pGridX = static_cast<int>(mPlayer.getPosition().x / mWorld.getTileSize());
             int pGridY = static_cast<int>(mPlayer.getPosition().y / mWorld.getTileSize());
-            for(int i = 0; i < mDraggedItem.count; i++) {
-                mWorld.spawnItem(pGridX, pGridY, mDraggedItem.id);
-            }
+            mWorld.spawnItem(pGridX, pGridY, mDraggedItem.id, mDraggedItem.count);
         }
         mDraggedItem.id = ItemID::AIR;
         mDraggedItem.count = 0;
     }
 }
 
+/**
+ * @brief Re-bins every mob's current bounds; grid ids are indices into mMobs.
+ */
+void Game::rebuildMobGrid() {
+    mMobGrid.clear();
+    for (size_t i = 0; i < mMobs.size(); ++i) mMobGrid.insert(i, mMobs[i]->getBounds());
+    mMobGrid.build();
+}
+
 /**
  * @brief Spawns visual debris particles of a specific material type.
  */
 void Game::spawnParticles(sf::Vector2f pos, int itemID, int count) {
-    sf::Color pColor = sf::Color::White;
-    switch(itemID) {
-        case ItemID::DIRT: pColor = sf::Color(139, 69, 19); break;
-        case ItemID::STONE: case ItemID::COAL:
-        case ItemID::FURNACE: pColor = sf::Color(128, 128, 128); break;
-        case ItemID::WOOD: case ItemID::CRAFTING_TABLE:
-        case ItemID::CHEST: case ItemID::DOOR:
-            pColor = sf::Color(101, 67, 33); break;
-        case ItemID::LEAVES: pColor = sf::Color(50, 205, 50); break;
-        case ItemID::MEAT: pColor = sf::Color(200, 0, 0); break;       // Blood
-        default: pColor = sf::Color(200, 200, 200); break;
-    }
+    sf::Color pColor(itemProperties(itemID).particleColor);
 
     for(int i = 0; i < count; ++i) {
-        Particle p;
-        p.position = pos;
         float vx = (rand() % 300) - 150.0f;
         float vy = -((rand() % 200) + 150.0f); // Always burst upwards
-        p.velocity = sf::Vector2f(vx, vy);
-        p.color = pColor;
-        p.maxLifetime = 0.3f + (rand() % 40) / 100.0f;
-        p.lifetime = p.maxLifetime;
-        p.size = 4.0f + (rand() % 4);
-        mParticles.push_back(p);
+        float lifetime = 0.3f + (rand() % 40) / 100.0f;
+        float size = 4.0f + (rand() % 4);
+        if (!mParticles.spawn(pos, sf::Vector2f(vx, vy), pColor, lifetime, size)) break; // Pool full
     }
 }
\ No newline at end of file
@@ -9,6 +9,10 @@
 #include <utility>
 #include <fstream>
 #include "Projectile.h"
+#include "ParticleSystem.h"
+#include "UIPanel.h"
+#include "ItemTable.h"
+#include "SpatialGrid.h"
 #include "TRex.h"
 
 /**
@@ -22,85 +26,6 @@ enum class GameState {
     Paused
 };
 
-/**
- * @enum ItemID
- * @brief Unique identifiers for blocks, items, tools, and weapons.
- */
-enum ItemID {
-    AIR = 0,
-
-    // --- BLOQUES (1 - 99) ---
-    DIRT = 1,
-    STONE = 2,
-    WOOD = 3,
-    LEAVES = 4,
-    TORCH = 5,
-    SAND = 6,
-    SNOW = 7,
-    BEDROCK = 8,
-    DOOR = 10,
-    DOOR_MID = 11,
-    DOOR_TOP = 12,
-    DOOR_OPEN = 13,
-    DOOR_OPEN_MID = 14,
-    DOOR_OPEN_TOP = 15,
-    CRAFTING_TABLE = 20,
-    FURNACE = 21,
-    CHEST = 22,
-
-    // --- ARMAS (100 - 199) ---
-    WOOD_SWORD = 100,
-    STONE_SWORD = 101,
-    IRON_SWORD = 102,
-    TUNGSTEN_SWORD = 103,
-    BOW = 110,
-    ARROW = 111,
-
-    // --- ÍTEMS USABLES / CONSUMIBLES (200 - 299) ---
-    MEAT = 200,
-    MEAT_MEDALLION = 201,
-
-    // --- HERRAMIENTAS (300 - 399) ---
-    WOOD_PICKAXE = 300,
-    STONE_PICKAXE = 301,
-    IRON_PICKAXE = 302,
-    TUNGSTEN_PICKAXE = 303,
-
-    // --- ARMADURAS (400 - 499) ---
-    WOOD_HELMET = 400,
-    WOOD_CHEST = 401,
-    WOOD_LEGS = 402,
-    WOOD_BOOTS = 403,
-
-    // --- MATERIALES / MINERALES (500 - 599) ---
-    COAL = 500,
-    COPPER = 501,
-    IRON = 502,
-    COBALT = 503,
-    TUNGSTEN = 504,
-    COPPER_INGOT = 510,
-    IRON_INGOT = 511,
-    COBALT_INGOT = 512,
-    TUNGSTEN_INGOT = 513,
-
-    // --- PAREDES DE FONDO (600 - 699) ---
-    BG_DIRT = 600,
-    BG_STONE = 601
-};
-
-/**
- * @struct Particle
- * @brief Simple structure for a visual particle effect.
- */
-struct Particle {
-    sf::Vector2f position;
-    sf::Vector2f velocity;
-    sf::Color color;
-    float lifetime;
-    float maxLifetime;
-    float size;
-};
-
 /**
  * @class Game
  * @brief Core game manager class that handles the game loop, rendering, logic, and state.
@@ -120,12 +45,6 @@ public:
     sf::Sprite mSkySprite;
 
 private:
-    struct ItemInfo {
-        std::string name;
-        float weight;
-        int maxStack; // Maximum quantity per slot (e.g., 99 blocks, 1 pickaxe)
-    };
-
     /**
      * @struct InventorySlot
      * @brief Represents a single slot in the inventory.
@@ -192,9 +111,6 @@ private:
     float mCurrentWeight = 0.0f;
     const float mMaxWeight = 100.0f; // Weight limit; exceeding it slows the player
 
-    // Database mapping item IDs to their properties
-    std::map<int, ItemInfo> mItemDatabase;
-
     // Inventory management helpers
     bool addItemToBackpack(int id, int amount);
     void calculateTotalWeight();
@@ -233,6 +149,11 @@ private:
     // Dynamic list of active entities (enemies/animals)
     std::vector<std::unique_ptr<Mob>> mMobs;
 
+    // Broadphase over mMobs (ids are indices into mMobs), rebuilt after mobs move or die
+    SpatialGrid mMobGrid{128.0f};
+    std::vector<size_t> mMobQuery; // Reused query results
+    void rebuildMobGrid();
+
     // Active projectiles
     std::vector<std::unique_ptr<Projectile>> mProjectiles;
 
@@ -316,10 +237,35 @@ private:
     void renderMenus();
     void renderDeathScreen();
 
+    // --- CACHED UI PANELS ---
+    // Static menu content (inventory, wheel, crafting list, chest and furnace
+    // slots) is redrawn into a render texture only when invalidated
+    UIPanel mMenuPanel;
+
+    /**
+     * @brief Marks the cached menus as stale. Called whenever an inventory,
+     * chest or furnace slot changes or a panel is opened or closed.
+     */
+    void invalidateMenus() { mMenuPanel.invalidate(); }
+
+    /**
+     * @brief Draws an item's icon from the shared texture atlas.
+     * @param target Window or cached panel to draw into.
+     * @param position Top-left corner (or center if centered is true).
+     * @param width Width the icon is scaled to (aspect ratio kept).
+     * @return False if the item has no icon (nothing drawn).
+     */
+    bool drawItemIcon(sf::RenderTarget& target, int id, sf::Vector2f position, float width, sf::Color color = sf::Color::White, bool centered = false);
+
+    // --- DEBUG OVERLAY (F3) ---
+    bool mShowDebugOverlay = false;
+    void renderDebugOverlay();
+
     void handleMouseClick(float mx, float my);
     void handleMouseRelease(float mx, float my);
 
-    std::vector<Particle> mParticles;
+    ParticleSystem mParticles;
+    SpriteBatch mSpriteBatch; // Player, mobs and projectiles (flushed once per frame)
     void spawnParticles(sf::Vector2f pos, int blockID, int count);
 
     GameState mGameState = GameState::MainMenu;
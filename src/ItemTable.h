@@ -0,0 +1,208 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+/**
+ * @enum ItemID
+ * @brief Unique identifiers for blocks, items, tools, and weapons.
+ */
+enum ItemID {
+    AIR = 0,
+
+    // --- BLOQUES (1 - 99) ---
+    DIRT = 1,
+    STONE = 2,
+    WOOD = 3,
+    LEAVES = 4,
+    TORCH = 5,
+    SAND = 6,
+    SNOW = 7,
+    BEDROCK = 8,
+    DOOR = 10,
+    DOOR_MID = 11,
+    DOOR_TOP = 12,
+    DOOR_OPEN = 13,
+    DOOR_OPEN_MID = 14,
+    DOOR_OPEN_TOP = 15,
+    CRAFTING_TABLE = 20,
+    FURNACE = 21,
+    CHEST = 22,
+
+    // --- ARMAS (100 - 199) ---
+    WOOD_SWORD = 100,
+    STONE_SWORD = 101,
+    IRON_SWORD = 102,
+    TUNGSTEN_SWORD = 103,
+    BOW = 110,
+    ARROW = 111,
+
+    // --- ÍTEMS USABLES / CONSUMIBLES (200 - 299) ---
+    MEAT = 200,
+    MEAT_MEDALLION = 201,
+
+    // --- HERRAMIENTAS (300 - 399) ---
+    WOOD_PICKAXE = 300,
+    STONE_PICKAXE = 301,
+    IRON_PICKAXE = 302,
+    TUNGSTEN_PICKAXE = 303,
+
+    // --- ARMADURAS (400 - 499) ---
+    WOOD_HELMET = 400,
+    WOOD_CHEST = 401,
+    WOOD_LEGS = 402,
+    WOOD_BOOTS = 403,
+
+    // --- MATERIALES / MINERALES (500 - 599) ---
+    COAL = 500,
+    COPPER = 501,
+    IRON = 502,
+    COBALT = 503,
+    TUNGSTEN = 504,
+    COPPER_INGOT = 510,
+    IRON_INGOT = 511,
+    COBALT_INGOT = 512,
+    TUNGSTEN_INGOT = 513,
+
+    // --- PAREDES DE FONDO (600 - 699) ---
+    BG_DIRT = 600,
+    BG_STONE = 601
+};
+
+/**
+ * @struct ItemProperties
+ * @brief Static properties of one item or block, as stored in the item table.
+ *
+ * The defaults describe an unknown block: solid, opaque, mined in one second
+ * by hand and not storable. Entries are written with the chainable setters
+ * below, so each row of the table only lists what differs from the defaults.
+ */
+struct ItemProperties {
+    const char* name = "";
+    bool solid = true;                   // Blocks entity movement
+    bool opaque = true;                  // Dims light like a solid tile
+    float hardness = 1.0f;               // Seconds to mine at speed 1 (0 = nothing to mine, < 0 = unbreakable)
+    int requiredTier = 0;                // Pickaxe tier needed to mine it
+    int light = 0;                       // Light level emitted when placed
+    int smeltResult = AIR;               // Furnace output for this input (AIR = cannot be smelted)
+    float burnTime = 0.0f;               // Seconds of furnace fuel per unit (0 = not a fuel)
+    std::uint32_t particleColor = 0xC8C8C8FF; // Debris colour as 0xRRGGBBAA
+    float weight = 0.0f;                 // Backpack weight per unit
+    int maxStack = 0;                    // Maximum quantity per slot (e.g., 99 blocks, 1 pickaxe)
+    int pickaxeTier = 0;                 // Mining level when held
+    float miningSpeed = 1.0f;            // Mining speed multiplier when held
+    int damage = 1;                      // Melee damage when held
+
+    constexpr ItemProperties storable(const char* n, float w, int stack) const {
+        ItemProperties p = *this; p.name = n; p.weight = w; p.maxStack = stack; return p;
+    }
+    constexpr ItemProperties passable() const {
+        ItemProperties p = *this; p.solid = false; p.opaque = false; return p;
+    }
+    constexpr ItemProperties mined(float h, int tier = 0) const {
+        ItemProperties p = *this; p.hardness = h; p.requiredTier = tier; return p;
+    }
+    constexpr ItemProperties glows(int level) const {
+        ItemProperties p = *this; p.light = level; return p;
+    }
+    constexpr ItemProperties smeltsInto(int result) const {
+        ItemProperties p = *this; p.smeltResult = result; return p;
+    }
+    constexpr ItemProperties burns(float seconds) const {
+        ItemProperties p = *this; p.burnTime = seconds; return p;
+    }
+    constexpr ItemProperties debris(std::uint32_t rgba) const {
+        ItemProperties p = *this; p.particleColor = rgba; return p;
+    }
+    constexpr ItemProperties tool(int tier, float speed, int dmg) const {
+        ItemProperties p = *this; p.pickaxeTier = tier; p.miningSpeed = speed; p.damage = dmg; return p;
+    }
+};
+
+inline constexpr int ITEM_TABLE_SIZE = ItemID::BG_STONE + 1;
+
+namespace ItemTableData {
+    inline constexpr std::uint32_t DIRT_BROWN = 0x8B4513FF;
+    inline constexpr std::uint32_t STONE_GREY = 0x808080FF;
+    inline constexpr std::uint32_t WOOD_BROWN = 0x654321FF;
+    inline constexpr std::uint32_t LEAF_GREEN = 0x32CD32FF;
+    inline constexpr std::uint32_t BLOOD_RED = 0xC80000FF;
+
+    /**
+     * @brief Fills the table. Adding a block or item only takes a line here (plus its enum value).
+     */
+    constexpr std::array<ItemProperties, ITEM_TABLE_SIZE> build() {
+        std::array<ItemProperties, ITEM_TABLE_SIZE> t{};
+        const ItemProperties base{};
+
+        // Blocks
+        t[ItemID::AIR]      = base.passable().mined(0.0f);
+        t[ItemID::DIRT]     = base.storable("Dirt", 1.0f, 99).mined(0.2f).debris(DIRT_BROWN);
+        t[ItemID::STONE]    = base.storable("Stone", 2.0f, 99).mined(1.0f, 1).debris(STONE_GREY);
+        t[ItemID::WOOD]     = base.storable("Log", 1.5f, 99).passable().mined(0.6f).burns(10.0f).debris(WOOD_BROWN);
+        t[ItemID::LEAVES]   = base.storable("Leaves", 0.1f, 99).passable().mined(0.1f).debris(LEAF_GREEN);
+        t[ItemID::TORCH]    = base.storable("Torch", 0.2f, 99).passable().mined(0.1f).glows(24);
+        t[ItemID::SAND]     = base.storable("Sand", 1.0f, 99);
+        t[ItemID::SNOW]     = base.storable("Snow", 1.0f, 99);
+        t[ItemID::BEDROCK]  = base.mined(-1.0f, 999);
+
+        // Structures (only the bottom door piece is an item)
+        t[ItemID::DOOR]           = base.storable("Wooden Door", 5.0f, 99).mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::DOOR_MID]       = base.mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::DOOR_TOP]       = base.mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::DOOR_OPEN]      = base.passable().mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::DOOR_OPEN_MID]  = base.passable().mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::DOOR_OPEN_TOP]  = base.passable().mined(0.5f).debris(WOOD_BROWN);
+        t[ItemID::CRAFTING_TABLE] = base.storable("Crafting Table", 3.0f, 99).mined(1.5f).debris(WOOD_BROWN);
+        t[ItemID::FURNACE]        = base.storable("Furnace", 4.0f, 99).mined(2.0f, 1).debris(STONE_GREY);
+        t[ItemID::CHEST]          = base.storable("Chest", 4.0f, 99).mined(1.5f).debris(WOOD_BROWN);
+
+        // Weapons
+        t[ItemID::WOOD_SWORD]     = base.storable("Wood Sword", 4.0f, 1).tool(0, 1.5f, 6);
+        t[ItemID::STONE_SWORD]    = base.storable("Stone Sword", 4.0f, 1).tool(0, 1.5f, 10);
+        t[ItemID::IRON_SWORD]     = base.storable("Iron Sword", 4.0f, 1).tool(0, 1.5f, 18);
+        t[ItemID::TUNGSTEN_SWORD] = base.storable("Tungsten Sword", 4.0f, 1).tool(0, 1.5f, 30);
+        t[ItemID::BOW]            = base.storable("Bow", 3.0f, 1);
+        t[ItemID::ARROW]          = base.storable("Arrow", 0.1f, 99);
+
+        // Consumables
+        t[ItemID::MEAT]           = base.storable("Meat", 0.5f, 20).debris(BLOOD_RED);
+        t[ItemID::MEAT_MEDALLION] = base.storable("Meat Medallion", 10.0f, 1);
+
+        // Tools
+        t[ItemID::WOOD_PICKAXE]     = base.storable("Wood Pickaxe", 5.0f, 1).tool(1, 3.0f, 3);
+        t[ItemID::STONE_PICKAXE]    = base.storable("Stone Pickaxe", 5.0f, 1).tool(2, 5.0f, 5);
+        t[ItemID::IRON_PICKAXE]     = base.storable("Iron Pickaxe", 5.0f, 1).tool(3, 10.0f, 8);
+        t[ItemID::TUNGSTEN_PICKAXE] = base.storable("Tungsten Pickaxe", 5.0f, 1).tool(4, 20.0f, 12);
+
+        // Armor
+        t[ItemID::WOOD_HELMET] = base.storable("Wood Helmet", 2.0f, 1);
+        t[ItemID::WOOD_CHEST]  = base.storable("Wood Chest", 4.0f, 1);
+        t[ItemID::WOOD_LEGS]   = base.storable("Wood Legs", 3.0f, 1);
+        t[ItemID::WOOD_BOOTS]  = base.storable("Wood Boots", 1.5f, 1);
+
+        // Minerals (also placed as ore blocks)
+        t[ItemID::COAL]     = base.storable("Coal", 1.0f, 99).mined(1.2f, 1).burns(40.0f).debris(STONE_GREY);
+        t[ItemID::COPPER]   = base.storable("Copper", 2.0f, 99).mined(1.5f, 2).smeltsInto(ItemID::COPPER_INGOT);
+        t[ItemID::IRON]     = base.storable("Iron", 2.0f, 99).mined(2.0f, 2).smeltsInto(ItemID::IRON_INGOT);
+        t[ItemID::COBALT]   = base.storable("Cobalt", 2.0f, 99).mined(3.0f, 3).smeltsInto(ItemID::COBALT_INGOT);
+        t[ItemID::TUNGSTEN] = base.storable("Tungsten", 2.0f, 99).mined(5.0f, 3).smeltsInto(ItemID::TUNGSTEN_INGOT);
+
+        // Ingots
+        t[ItemID::COPPER_INGOT]   = base.storable("Copper Ingot", 1.5f, 99);
+        t[ItemID::IRON_INGOT]     = base.storable("Iron Ingot", 1.5f, 99);
+        t[ItemID::COBALT_INGOT]   = base.storable("Cobalt Ingot", 1.5f, 99);
+        t[ItemID::TUNGSTEN_INGOT] = base.storable("Tungsten Ingot", 1.5f, 99);
+        return t;
+    }
+
+    inline constexpr std::array<ItemProperties, ITEM_TABLE_SIZE> TABLE = build();
+    inline constexpr ItemProperties UNKNOWN{};
+}
+
+/**
+ * @brief Properties of an item or block ID. One indexed load; unknown IDs get the defaults.
+ */
+constexpr const ItemProperties& itemProperties(int id) {
+    return (static_cast<unsigned>(id) < static_cast<unsigned>(ITEM_TABLE_SIZE))
+        ? ItemTableData::TABLE[id] : ItemTableData::UNKNOWN;
+}
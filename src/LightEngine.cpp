@@ -0,0 +1,163 @@
+#include "LightEngine.h"
+#include "World.h"
+#include "Game.h"
+
+namespace {
+    // 4-neighbourhood visited by both fills
+    const int NEIGHBOURS[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+    static_assert(itemProperties(ItemID::TORCH).light == LightEngine::MAX_LIGHT, "Torches emit the brightest light level");
+
+    int emission(int blockID) {
+        return itemProperties(blockID).light;
+    }
+
+    int falloff(int blockID) {
+        return itemProperties(blockID).opaque ? LightEngine::SOLID_FALLOFF : LightEngine::AIR_FALLOFF;
+    }
+}
+
+LightEngine::LightEngine(ChunkStore& chunks)
+    : mChunks(chunks)
+{
+}
+
+Chunk* LightEngine::findLitChunk(int x, int y, int& index) const {
+    if (y < 0 || y >= WORLD_HEIGHT) return nullptr;
+
+    Chunk* chunk = mChunks.find(x >> CHUNK_SHIFT);
+    if (!chunk || chunk->stage != ChunkStage::Complete || chunk->light.empty()) return nullptr;
+
+    index = y * CHUNK_WIDTH + (x & CHUNK_MASK);
+    return chunk;
+}
+
+int LightEngine::getLevel(int x, int y) const {
+    int index = 0;
+    const Chunk* chunk = findLitChunk(x, y, index);
+    return chunk ? chunk->light[index] : 0;
+}
+
+void LightEngine::lightChunk(int chunkX, Chunk& chunk) {
+    std::vector<int> ids = chunk.blocks.toVector();
+    chunk.light.assign(CHUNK_WIDTH * WORLD_HEIGHT, 0);
+
+    int firstX = chunkX * CHUNK_WIDTH;
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+            int level = emission(ids[y * CHUNK_WIDTH + lx]);
+            if (level == 0) continue;
+
+            chunk.light[y * CHUNK_WIDTH + lx] = static_cast<uint8_t>(level);
+            mAddQueue.push_back({ firstX + lx, y, 0 });
+        }
+    }
+
+    // Light already in the neighbours spills over the borders (and this chunk's
+    // own torches reach into them through the same fill)
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        if (getLevel(firstX - 1, y) > 0) mAddQueue.push_back({ firstX - 1, y, 0 });
+        if (getLevel(firstX + CHUNK_WIDTH, y) > 0) mAddQueue.push_back({ firstX + CHUNK_WIDTH, y, 0 });
+    }
+
+    propagateAdd();
+}
+
+/**
+ * @brief Clears the light that may have come through the tile, then refills.
+ * Handles every kind of edit (torch placed or removed, wall built or mined)
+ * the same way: light that depended on the old block is removed, and the
+ * surroundings flow back in through the new one.
+ */
+void LightEngine::onBlockChanged(int x, int y) {
+    int index = 0;
+    Chunk* chunk = findLitChunk(x, y, index);
+    if (!chunk) return;
+
+    if (chunk->light[index] > 0) {
+        mRemoveQueue.push_back({ x, y, chunk->light[index] });
+        chunk->light[index] = 0;
+        propagateRemove();
+    }
+
+    int level = emission(chunk->blocks.get(index));
+    if (level > 0) {
+        chunk->light[index] = static_cast<uint8_t>(level);
+        mAddQueue.push_back({ x, y, 0 });
+    }
+
+    for (const auto& offset : NEIGHBOURS) {
+        if (getLevel(x + offset[0], y + offset[1]) > 0) mAddQueue.push_back({ x + offset[0], y + offset[1], 0 });
+    }
+
+    propagateAdd();
+}
+
+/**
+ * @brief Breadth-first spread: each tile passes its level minus the falloff of
+ * the tile being entered, and only where that beats the light already there.
+ */
+void LightEngine::propagateAdd() {
+    for (size_t head = 0; head < mAddQueue.size(); ++head) {
+        Node node = mAddQueue[head];
+
+        int index = 0;
+        const Chunk* chunk = findLitChunk(node.x, node.y, index);
+        if (!chunk) continue;
+        int level = chunk->light[index];
+
+        for (const auto& offset : NEIGHBOURS) {
+            int nx = node.x + offset[0];
+            int ny = node.y + offset[1];
+
+            int nIndex = 0;
+            Chunk* neighbour = findLitChunk(nx, ny, nIndex);
+            if (!neighbour) continue;
+
+            int next = level - falloff(neighbour->blocks.get(nIndex));
+            if (next <= neighbour->light[nIndex]) continue;
+
+            neighbour->light[nIndex] = static_cast<uint8_t>(next);
+            mAddQueue.push_back({ nx, ny, 0 });
+        }
+    }
+    mAddQueue.clear();
+}
+
+/**
+ * @brief Breadth-first removal. Dimmer neighbours were lit through the removed
+ * tile and are cleared in turn; brighter ones belong to another source and are
+ * queued to refill the cleared area. Light sources are cleared like any tile
+ * but immediately re-emit.
+ */
+void LightEngine::propagateRemove() {
+    for (size_t head = 0; head < mRemoveQueue.size(); ++head) {
+        Node node = mRemoveQueue[head];
+
+        for (const auto& offset : NEIGHBOURS) {
+            int nx = node.x + offset[0];
+            int ny = node.y + offset[1];
+
+            int nIndex = 0;
+            Chunk* neighbour = findLitChunk(nx, ny, nIndex);
+            if (!neighbour) continue;
+
+            int level = neighbour->light[nIndex];
+            if (level == 0) continue;
+
+            if (level < node.level) {
+                neighbour->light[nIndex] = 0;
+                mRemoveQueue.push_back({ nx, ny, level });
+
+                int emitted = emission(neighbour->blocks.get(nIndex));
+                if (emitted > 0) {
+                    neighbour->light[nIndex] = static_cast<uint8_t>(emitted);
+                    mAddQueue.push_back({ nx, ny, 0 });
+                }
+            } else {
+                mAddQueue.push_back({ nx, ny, 0 });
+            }
+        }
+    }
+    mRemoveQueue.clear();
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "ChunkStore.h"
+
+/**
+ * @class LightEngine
+ * @brief Flood-fill block light (torches) stored per chunk in Chunk::light.
+ *
+ * Light spreads from every emitting block with a breadth-first fill that loses
+ * a few levels per tile, and many more when entering a solid block, so walls
+ * hold light back instead of letting it leak through. Edits are incremental:
+ * a removal pass clears the light that depended on the changed tile, then an
+ * add pass refills the cleared area from the light still around it.
+ *
+ * The fill only walks resident Complete chunks. A chunk that arrives later
+ * pulls its neighbours' border light in (see lightChunk).
+ */
+class LightEngine {
+public:
+    static const int MAX_LIGHT = 24;     // Level of a torch tile
+    static const int AIR_FALLOFF = 3;    // Levels lost entering a non-solid tile (8 tiles of reach)
+    static const int SOLID_FALLOFF = 8;  // Levels lost entering a solid tile
+
+    explicit LightEngine(ChunkStore& chunks);
+
+    /**
+     * @brief Lights a chunk that just became Complete: seeds its light sources
+     * and lets light flow across both borders.
+     */
+    void lightChunk(int chunkX, Chunk& chunk);
+
+    /**
+     * @brief Updates the light around a tile whose block has just changed.
+     */
+    void onBlockChanged(int x, int y);
+
+    /**
+     * @brief Block light level of a tile (0 if its chunk is not lit yet).
+     */
+    int getLevel(int x, int y) const;
+
+private:
+    struct Node {
+        int x, y;
+        int level; // Level the tile had before removal (remove queue only)
+    };
+
+    /**
+     * @brief Finds the chunk holding a tile, if it is resident, Complete and lit.
+     * @param index Receives the cell index inside the chunk.
+     */
+    Chunk* findLitChunk(int x, int y, int& index) const;
+
+    void propagateAdd();
+    void propagateRemove();
+
+    ChunkStore& mChunks;
+
+    // Reused between updates to avoid reallocating
+    std::vector<Node> mAddQueue;
+    std::vector<Node> mRemoveQueue;
+};
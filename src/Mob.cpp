@@ -20,18 +20,13 @@ Mob::Mob(sf::Vector2f startPos, const sf::Texture& texture, int maxHp)
 }
 
 /**
- * @brief Renders the mob to the window.
+ * @brief Queues the mob for drawing.
  * Applies a red tint if the mob has recently taken damage.
- * @param window The render window.
- * @param ambientLight The current ambient light color (for day/night cycle).
+ * @param batch The sprite batch of the current frame.
  */
-void Mob::render(sf::RenderWindow& window, sf::Color ambientLight) {
-    if (mDamageTimer > 0.0f) {
-        mSprite.setColor(sf::Color::Red);
-    } else {
-        mSprite.setColor(ambientLight);
-    }
-    window.draw(mSprite);
+void Mob::render(SpriteBatch& batch) {
+    mSprite.setColor((mDamageTimer > 0.0f) ? sf::Color::Red : sf::Color::White);
+    batch.draw(mSprite, RenderLayer::Mobs);
 }
 
 /**
@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 
 #include "World.h"
+#include "SpriteBatch.h"
 
 
 /**
@@ -35,16 +36,14 @@ public:
      * @param dt The time elapsed since the last frame.
      * @param playerPos The current position of the player.
      * @param world The game world for collision detection.
-     * @param lightLevel The current environmental light level (0.0 to 1.0).
      */
-    virtual void update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) = 0;
+    virtual void update(sf::Time dt, sf::Vector2f playerPos, World& world) = 0;
 
     /**
-     * @brief Renders the mob to the specified window.
-     * @param window The SFML RenderWindow to draw on.
-     * @param ambientLight The ambient light color affecting the mob's sprite.
+     * @brief Queues the mob's sprite (unlit; the world's lighting pass darkens it).
+     * @param batch The sprite batch of the current frame.
      */
-    void render(sf::RenderWindow& window, sf::Color ambientLight);
+    void render(SpriteBatch& batch);
 
     /**
      * @brief Applies damage to the mob and triggers knockback.
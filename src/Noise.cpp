@@ -0,0 +1,139 @@
+#include "Noise.h"
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define NOISE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NOISE_SSE2 1
+#endif
+
+namespace {
+    const float PI = 3.14159265358979f;
+    const float HALF_PI = 1.57079632679490f;
+    const float INV_TWO_PI = 0.159154943091895f;
+
+    // 2*PI split in two parts (Cody-Waite) so range reduction keeps precision
+    const float TWO_PI_HI = 6.28125f;
+    const float TWO_PI_LO = 0.00193530717958647f;
+
+    // Taylor coefficients of sin on [-PI/2, PI/2] up to x^11
+    const float C3 = -1.66666666666666667e-1f;
+    const float C5 = 8.33333333333333333e-3f;
+    const float C7 = -1.98412698412698413e-4f;
+    const float C9 = 2.75573192239858907e-6f;
+    const float C11 = -2.50521083854417188e-8f;
+
+    /**
+     * @brief Reference implementation; the SIMD paths mirror it operation by operation.
+     */
+    inline float sinScalar(float x) {
+        // Reduce to [-PI, PI]
+        float k = std::nearbyint(x * INV_TWO_PI);
+        float r = (x - k * TWO_PI_HI) - k * TWO_PI_LO;
+
+        // Fold to [-PI/2, PI/2] using sin(PI - r) = sin(r)
+        if (r > HALF_PI) r = PI - r;
+        else if (r < -HALF_PI) r = -PI - r;
+
+        float r2 = r * r;
+        float p = C11;
+        p = p * r2 + C9;
+        p = p * r2 + C7;
+        p = p * r2 + C5;
+        p = p * r2 + C3;
+        return r + (r * r2) * p;
+    }
+
+#if defined(NOISE_AVX2)
+    inline __m256 sin8(__m256 x) {
+        __m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(INV_TWO_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256 r = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(k, _mm256_set1_ps(TWO_PI_HI))),
+                                 _mm256_mul_ps(k, _mm256_set1_ps(TWO_PI_LO)));
+
+        __m256 high = _mm256_cmp_ps(r, _mm256_set1_ps(HALF_PI), _CMP_GT_OQ);
+        __m256 low = _mm256_cmp_ps(r, _mm256_set1_ps(-HALF_PI), _CMP_LT_OQ);
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI), r), high);
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(-PI), r), low);
+
+        __m256 r2 = _mm256_mul_ps(r, r);
+        __m256 p = _mm256_set1_ps(C11);
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(C9));
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(C7));
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(C5));
+        p = _mm256_add_ps(_mm256_mul_ps(p, r2), _mm256_set1_ps(C3));
+        return _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), p));
+    }
+#elif defined(NOISE_SSE2)
+    inline __m128 select4(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    inline __m128 sin4(__m128 x) {
+        // cvtps rounds to nearest-even under the default MXCSR, like std::nearbyint
+        __m128 k = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(INV_TWO_PI))));
+        __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(TWO_PI_HI))),
+                              _mm_mul_ps(k, _mm_set1_ps(TWO_PI_LO)));
+
+        __m128 high = _mm_cmpgt_ps(r, _mm_set1_ps(HALF_PI));
+        __m128 low = _mm_cmplt_ps(r, _mm_set1_ps(-HALF_PI));
+        r = select4(high, _mm_sub_ps(_mm_set1_ps(PI), r), r);
+        r = select4(low, _mm_sub_ps(_mm_set1_ps(-PI), r), r);
+
+        __m128 r2 = _mm_mul_ps(r, r);
+        __m128 p = _mm_set1_ps(C11);
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(C9));
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(C7));
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(C5));
+        p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(C3));
+        return _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+    }
+#endif
+
+    /**
+     * @brief Runs the widest available kernel over the array, scalar for the tail.
+     * @param phase Added to every input first (HALF_PI turns sin into cos).
+     */
+    void sinKernel(const float* in, float* out, int count, float phase) {
+        int i = 0;
+#if defined(NOISE_AVX2)
+        __m256 shift = _mm256_set1_ps(phase);
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(out + i, sin8(_mm256_add_ps(_mm256_loadu_ps(in + i), shift)));
+        }
+#elif defined(NOISE_SSE2)
+        __m128 shift = _mm_set1_ps(phase);
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(out + i, sin4(_mm_add_ps(_mm_loadu_ps(in + i), shift)));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = sinScalar(in[i] + phase);
+        }
+    }
+}
+
+namespace Noise {
+    void sinBatch(const float* in, float* out, int count) {
+        sinKernel(in, out, count, 0.0f);
+    }
+
+    void cosBatch(const float* in, float* out, int count) {
+        sinKernel(in, out, count, HALF_PI); // cos(x) = sin(x + PI/2)
+    }
+
+    float sinApprox(float x) {
+        return sinScalar(x);
+    }
+
+    const char* getKernelName() {
+#if defined(NOISE_AVX2)
+        return "AVX2";
+#elif defined(NOISE_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+/**
+ * @namespace Noise
+ * @brief Batch trigonometric kernels for world generation.
+ *
+ * Terrain, biome and cave fields are built from sine waves. Evaluating them
+ * one std::sin call at a time dominated chunk generation, so these kernels
+ * process whole arrays with SIMD (AVX2 or SSE2 when the compiler targets
+ * them, scalar otherwise) using a polynomial approximation (max error ~1e-7
+ * on the reduced range).
+ *
+ * Every code path performs the same float operations in the same order
+ * (no FMA), so a given seed produces the same world on every machine.
+ */
+namespace Noise {
+    /**
+     * @brief out[i] = sin(in[i]) for count values. in and out may alias.
+     */
+    void sinBatch(const float* in, float* out, int count);
+
+    /**
+     * @brief out[i] = cos(in[i]) for count values. in and out may alias.
+     */
+    void cosBatch(const float* in, float* out, int count);
+
+    /**
+     * @brief Single-value version of the same approximation (matches the batch output).
+     */
+    float sinApprox(float x);
+
+    /**
+     * @brief Name of the kernel selected at compile time ("AVX2", "SSE2" or "Scalar").
+     */
+    const char* getKernelName();
+}
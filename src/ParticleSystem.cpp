@@ -0,0 +1,89 @@
+#include "ParticleSystem.h"
+
+ParticleSystem::ParticleSystem(size_t capacity)
+    : mCapacity(capacity)
+    , mCount(0)
+    , mPosX(capacity), mPosY(capacity)
+    , mVelX(capacity), mVelY(capacity)
+    , mLifetime(capacity), mMaxLifetime(capacity)
+    , mSize(capacity)
+    , mColor(capacity)
+    , mVertices(sf::Quads)
+{
+}
+
+bool ParticleSystem::spawn(sf::Vector2f position, sf::Vector2f velocity, sf::Color color, float lifetime, float size) {
+    if (mCount == mCapacity) return false;
+
+    size_t i = mCount++;
+    mPosX[i] = position.x;
+    mPosY[i] = position.y;
+    mVelX[i] = velocity.x;
+    mVelY[i] = velocity.y;
+    mLifetime[i] = lifetime;
+    mMaxLifetime[i] = lifetime;
+    mSize[i] = size;
+    mColor[i] = color;
+    return true;
+}
+
+void ParticleSystem::update(float dt, float gravity) {
+    // Integration: independent per-element arithmetic over raw arrays (no
+    // branches, no aliasing between fields) so the loop vectorizes
+    float* posX = mPosX.data();
+    float* posY = mPosY.data();
+    const float* velX = mVelX.data();
+    float* velY = mVelY.data();
+    float* lifetime = mLifetime.data();
+
+    for (size_t i = 0; i < mCount; ++i) {
+        velY[i] += gravity * dt;
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        lifetime[i] -= dt;
+    }
+
+    // Compaction: the particle swapped into slot i has not been checked yet
+    size_t i = 0;
+    while (i < mCount) {
+        if (mLifetime[i] <= 0.0f) removeAt(i);
+        else ++i;
+    }
+}
+
+void ParticleSystem::removeAt(size_t index) {
+    size_t last = --mCount;
+    mPosX[index] = mPosX[last];
+    mPosY[index] = mPosY[last];
+    mVelX[index] = mVelX[last];
+    mVelY[index] = mVelY[last];
+    mLifetime[index] = mLifetime[last];
+    mMaxLifetime[index] = mMaxLifetime[last];
+    mSize[index] = mSize[last];
+    mColor[index] = mColor[last];
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target) {
+    if (mCount == 0) return;
+    target.draw(buildVertices());
+}
+
+const sf::VertexArray& ParticleSystem::buildVertices() {
+    mVertices.resize(mCount * 4);
+    for (size_t i = 0; i < mCount; ++i) {
+        float left = mPosX[i];
+        float top = mPosY[i];
+        float right = left + mSize[i];
+        float bottom = top + mSize[i];
+
+        sf::Color color = mColor[i];
+        color.a = static_cast<sf::Uint8>(255.0f * (mLifetime[i] / mMaxLifetime[i]));
+
+        sf::Vertex* quad = &mVertices[i * 4];
+        quad[0] = sf::Vertex(sf::Vector2f(left, top), color);
+        quad[1] = sf::Vertex(sf::Vector2f(right, top), color);
+        quad[2] = sf::Vertex(sf::Vector2f(right, bottom), color);
+        quad[3] = sf::Vertex(sf::Vector2f(left, bottom), color);
+    }
+    return mVertices;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ParticleSystem
+ * @brief Fixed-capacity pool of short-lived visual particles.
+ *
+ * Particles are stored as a structure of arrays (one array per field) and
+ * kept packed at the front: a dead particle is replaced by the last live one
+ * (swap-remove), so removal is O(1) and order is not preserved. The update
+ * loop walks plain float arrays, which the compiler can vectorize, and all
+ * particles are drawn as one vertex array of quads.
+ *
+ * Spawning into a full pool is ignored: effects lose a few particles under
+ * extreme load instead of growing memory.
+ */
+class ParticleSystem {
+public:
+    static const size_t DEFAULT_CAPACITY = 8192;
+
+    explicit ParticleSystem(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Adds one particle.
+     * @return False if the pool is full (the particle is dropped).
+     */
+    bool spawn(sf::Vector2f position, sf::Vector2f velocity, sf::Color color, float lifetime, float size);
+
+    /**
+     * @brief Integrates motion under gravity, ages every particle and removes the expired ones.
+     * @param dt Seconds elapsed.
+     * @param gravity Downward acceleration in pixels per second squared.
+     */
+    void update(float dt, float gravity);
+
+    /**
+     * @brief Draws every live particle as a square fading out over its lifetime (one draw call).
+     */
+    void draw(sf::RenderTarget& target);
+
+    /**
+     * @brief Rebuilds the quads of every live particle without drawing them.
+     * @return The vertex array draw() submits (4 vertices per particle).
+     */
+    const sf::VertexArray& buildVertices();
+
+    void clear() { mCount = 0; }
+
+    size_t size() const { return mCount; }
+    size_t capacity() const { return mCapacity; }
+
+private:
+    void removeAt(size_t index);
+
+    size_t mCapacity;
+    size_t mCount;
+
+    // One entry per particle, [0, mCount) live
+    std::vector<float> mPosX, mPosY;
+    std::vector<float> mVelX, mVelY;
+    std::vector<float> mLifetime, mMaxLifetime;
+    std::vector<float> mSize;
+    std::vector<sf::Color> mColor;
+
+    sf::VertexArray mVertices; // Rebuilt by draw(), reuses its storage
+};
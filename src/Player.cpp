@@ -84,9 +84,7 @@ void Player::handleInput(bool isInventoryOpen) {
 void Player::update(sf::Time dt, World& world) {
     handleStatusEffects(dt);
     float tileSize = world.getTileSize();
-    sf::Vector2f originalPos = mSprite.getPosition();
-    sf::FloatRect bounds = mSprite.getGlobalBounds();
-    float skinW = 4.0f, skinH = 0.5f; // Hitbox skin to prevent getting stuck
+    float skinW = 4.0f; // Hitbox skin so wall edges do not catch the sprite's sides
 
     // ==========================================
     // 1. COMBAT STATE MACHINE
@@ -125,14 +123,16 @@ void Player::update(sf::Time dt, World& world) {
     bool isHoldingBow = (mEquippedWeaponID == ItemID::BOW);
 
     if (isHoldingMelee || isHoldingBow) {
-        const sf::Texture* tex = world.getHeldTexture(mEquippedWeaponID);
-        if (tex && mWeaponSprite.getTexture() != tex) {
-            mWeaponSprite.setTexture(*tex, true);
+        // All held tools share the atlas page, so a weapon change is detected by its rect
+        TextureAtlas::Region held = world.getHeldRegion(mEquippedWeaponID);
+        if (held.texture && (mWeaponSprite.getTexture() != held.texture || mWeaponSprite.getTextureRect() != held.rect)) {
+            mWeaponSprite.setTexture(*held.texture);
+            mWeaponSprite.setTextureRect(held.rect);
             // Set origin based on weapon type
             if (isHoldingBow) {
-                mWeaponSprite.setOrigin(tex->getSize().x / 2.0f, tex->getSize().y / 2.0f); // Center grip
+                mWeaponSprite.setOrigin(held.rect.width / 2.0f, held.rect.height / 2.0f); // Center grip
             } else {
-                mWeaponSprite.setOrigin(tex->getSize().x * 0.15f, tex->getSize().y * 0.75f); // Handle grip
+                mWeaponSprite.setOrigin(held.rect.width * 0.15f, held.rect.height * 0.75f); // Handle grip
             }
         }
 
@@ -190,62 +190,17 @@ void Player::update(sf::Time dt, World& world) {
     // ==========================================
     // 3. COLLISION DETECTION & RESPONSE
     // ==========================================
-    auto checkCollision = [&](sf::FloatRect rect) -> bool {
-        int left   = static_cast<int>(std::floor(rect.left / tileSize));
-        int right  = static_cast<int>(std::floor((rect.left + rect.width) / tileSize));
-        int top    = static_cast<int>(std::floor(rect.top / tileSize));
-        int bottom = static_cast<int>(std::floor((rect.top + rect.height) / tileSize));
-        for (int x = left; x <= right; ++x) {
-            for (int y = top; y <= bottom; ++y) {
-                if (world.isSolid(world.getBlock(x, y))) return true;
-            }
-        }
-        return false;
-    };
-
-    // --- X-AXIS COLLISION ---
-    float dx = mVelocity.x * dt.asSeconds();
-    mSprite.move(dx, 0.f);
-    sf::FloatRect hitboxX = mSprite.getGlobalBounds();
-    hitboxX.left += skinW; hitboxX.width -= (skinW * 2);
-    hitboxX.top += skinH; hitboxX.height -= (skinH * 2);
-
-    if (checkCollision(hitboxX)) {
-        // Auto-step logic
-        float stepHeight = tileSize + 0.1f;
-        sf::FloatRect stepHitbox = hitboxX;
-        stepHitbox.top -= stepHeight;
-        if (!checkCollision(stepHitbox)) {
-            mSprite.move(0.f, -stepHeight);
-        } else {
-            mSprite.setPosition(originalPos.x, mSprite.getPosition().y);
-            mVelocity.x = 0.0f; // Stop on wall impact
-        }
-    }
+    sf::FloatRect hitbox = mSprite.getGlobalBounds();
+    hitbox.left += skinW; hitbox.width -= (skinW * 2);
 
-    // --- Y-AXIS COLLISION ---
-    float dy = mVelocity.y * dt.asSeconds();
-    mSprite.move(0.f, dy);
-    sf::FloatRect hitboxY = mSprite.getGlobalBounds();
-    hitboxY.left += skinW; hitboxY.width -= (skinW * 2);
-
-    if (checkCollision(hitboxY)) {
-        if (mVelocity.y > 0) { // Hitting ground
-            float playerBottom = hitboxY.top + hitboxY.height;
-            int blockY = static_cast<int>(std::floor(playerBottom / tileSize));
-            float newY = (blockY * tileSize) - bounds.height;
-            if (std::abs(mSprite.getPosition().y - newY) < tileSize) mSprite.setPosition(mSprite.getPosition().x, newY);
-            else mSprite.move(0.f, -dy);
-            mVelocity.y = 0;
-            mIsGrounded = true;
-        }
-        else if (mVelocity.y < 0) { // Hitting ceiling
-            mSprite.move(0.f, -dy);
-            mVelocity.y = 0;
-        }
-    } else {
-        mIsGrounded = false;
-    }
+    // Swept against the tiles: walks up one-block ledges (auto-step) and lands exactly on the floor
+    sf::Vector2f motion = mVelocity * dt.asSeconds();
+    TileCollision::MoveResult move = world.getCollision().move(hitbox, motion, tileSize + 0.1f);
+    mSprite.move(move.offset);
+
+    if (move.hitWall) mVelocity.x = 0.0f; // Stop on wall impact
+    if (move.hitFloor || move.hitCeiling) mVelocity.y = 0.0f;
+    mIsGrounded = move.hitFloor;
 
     // ==========================================
     // 4. ANIMATION & VISUALS
@@ -272,10 +227,13 @@ void Player::update(sf::Time dt, World& world) {
     sf::IntRect animRect(mCurrentFrame * mFrameWidth, mCurrentRow * mFrameHeight, mFrameWidth, mFrameHeight);
     mSprite.setTextureRect(animRect);
 
-    // Sync armor layers with player animation
+    // Sync armor layers with player animation (same frame, offset to the sheet's place in the atlas)
     for (int i = 0; i < 4; ++i) {
-        if (mArmorAnimTextures[i] != nullptr) {
-            mArmorAnimSprites[i].setTextureRect(animRect);
+        if (mArmorAnimRegions[i].texture != nullptr) {
+            sf::IntRect armorRect = animRect;
+            armorRect.left += mArmorAnimRegions[i].rect.left;
+            armorRect.top += mArmorAnimRegions[i].rect.top;
+            mArmorAnimSprites[i].setTextureRect(armorRect);
         }
     }
 
@@ -286,34 +244,28 @@ void Player::update(sf::Time dt, World& world) {
 }
 
 /**
- * @brief Renders the player, armor layers, and held weapon.
- * @param window The SFML RenderWindow to draw on.
- * @param lightColor The calculated ambient light color.
+ * @brief Queues the player, armor layers, and held weapon for drawing.
+ * Drawn unlit (the world's lighting pass darkens it); the body keeps the
+ * damage flash color set in update().
+ * @param batch The sprite batch of the current frame.
  */
-void Player::render(sf::RenderWindow& window, sf::Color lightColor) {
+void Player::render(SpriteBatch& batch) {
     // 1. Draw player body
-    mSprite.setColor(lightColor);
-    window.draw(mSprite);
+    batch.draw(mSprite, RenderLayer::PlayerBody);
 
     // 2. Draw armor layers on top
     for (int i = 0; i < 4; ++i) {
-        if (mArmorAnimTextures[i] != nullptr) {
+        if (mArmorAnimRegions[i].texture != nullptr) {
             mArmorAnimSprites[i].setPosition(mSprite.getPosition());
             mArmorAnimSprites[i].setScale(mSprite.getScale());
-            mArmorAnimSprites[i].setColor(lightColor);
-            window.draw(mArmorAnimSprites[i]);
+            batch.draw(mArmorAnimSprites[i], RenderLayer::PlayerArmor); // All pieces share the atlas page: one draw
         }
     }
 
     // 3. Draw weapon on top of everything
     bool isHoldingWeapon = (mEquippedWeaponID >= 21 && mEquippedWeaponID <= 35);
     if (isHoldingWeapon) {
-        sf::Color weaponColor = lightColor;
-        weaponColor.r = std::min(255, weaponColor.r + 30);
-        weaponColor.g = std::min(255, weaponColor.g + 30);
-        weaponColor.b = std::min(255, weaponColor.b + 30);
-        mWeaponSprite.setColor(weaponColor);
-        window.draw(mWeaponSprite);
+        batch.draw(mWeaponSprite, RenderLayer::PlayerWeapon);
     }
 }
 
@@ -365,21 +317,22 @@ sf::FloatRect Player::getWeaponHitbox() const {
 }
 
 /**
- * @brief Sets the textures for the animated armor layers.
- * @param head Helmet texture.
- * @param chest Chestplate texture.
- * @param legs Leggings texture.
- * @param boots Boots texture.
+ * @brief Sets the spritesheets for the animated armor layers.
+ * @param head Helmet sheet.
+ * @param chest Chestplate sheet.
+ * @param legs Leggings sheet.
+ * @param boots Boots sheet.
  */
-void Player::setArmorAnimTextures(const sf::Texture* head, const sf::Texture* chest, const sf::Texture* legs, const sf::Texture* boots) {
-    mArmorAnimTextures[0] = head;
-    mArmorAnimTextures[1] = chest;
-    mArmorAnimTextures[2] = legs;
-    mArmorAnimTextures[3] = boots;
+void Player::setArmorAnimRegions(const TextureAtlas::Region& head, const TextureAtlas::Region& chest,
+                                 const TextureAtlas::Region& legs, const TextureAtlas::Region& boots) {
+    mArmorAnimRegions[0] = head;
+    mArmorAnimRegions[1] = chest;
+    mArmorAnimRegions[2] = legs;
+    mArmorAnimRegions[3] = boots;
 
     for (int i = 0; i < 4; ++i) {
-        if (mArmorAnimTextures[i] != nullptr) {
-            mArmorAnimSprites[i].setTexture(*mArmorAnimTextures[i]);
+        if (mArmorAnimRegions[i].texture != nullptr) {
+            mArmorAnimSprites[i].setTexture(*mArmorAnimRegions[i].texture);
             // Origin must match the player's sprite for correct layering
             mArmorAnimSprites[i].setOrigin(mFrameWidth / 2.f, mFrameHeight / 2.f);
         }
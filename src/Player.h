@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "World.h"
+#include "SpriteBatch.h"
 
 /**
  * @class Player
@@ -29,10 +30,9 @@ public:
 
     /**
      * @brief Draws the player and their equipment to the window.
-     * @param window The render window.
-     * @param lightColor The ambient light color affecting the player's sprite.
+     * @param batch The sprite batch of the current frame.
      */
-    void render(sf::RenderWindow& window, sf::Color lightColor);
+    void render(SpriteBatch& batch);
 
     // --- Getters and Setters ---
     sf::Vector2f getPosition() const { return mSprite.getPosition(); }
@@ -42,6 +42,7 @@ public:
     int getHp() const { return mHp; }
     int getMaxHp() const { return mMaxHp; }
     void setHp(int hp) { mHp = hp; }
+    sf::Vector2f getVelocity() const { return mVelocity; }
     void setVelocity(sf::Vector2f vel) { mVelocity = vel; }
     void heal(int amount);
     void setOverweight(bool isHeavy) { mIsOverweight = isHeavy; }
@@ -73,9 +74,10 @@ public:
     void registerHit() { mHasHitThisSwing = true; } // Prevents hitting multiple enemies with one swing
 
     /**
-     * @brief Sets the textures for the animated armor layers.
+     * @brief Sets the atlas regions of the animated armor layers (empty region = no armor).
      */
-    void setArmorAnimTextures(const sf::Texture* head, const sf::Texture* chest, const sf::Texture* legs, const sf::Texture* boots);
+    void setArmorAnimRegions(const TextureAtlas::Region& head, const TextureAtlas::Region& chest,
+                             const TextureAtlas::Region& legs, const TextureAtlas::Region& boots);
 
     // Funciones de Estados
     void applyBleeding(float duration);
@@ -134,7 +136,7 @@ private:
     int mEquippedWeaponID = 0;
     bool mHasHitThisSwing = false; // Safety flag for single-hit-per-swing logic
     sf::Sprite mArmorAnimSprites[4]; // Sprites for head, chest, legs, boots
-    const sf::Texture* mArmorAnimTextures[4] = {nullptr, nullptr, nullptr, nullptr};
+    TextureAtlas::Region mArmorAnimRegions[4]; // Spritesheets inside the atlas (texture nullptr = none)
 
     // --- NUEVO: SISTEMA DE ESTADOS ---
     bool mIsBleeding;
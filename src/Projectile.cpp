@@ -1,4 +1,5 @@
 #include "Projectile.h"
+#include <algorithm>
 #include <cmath>
 #include "Game.h"
 
@@ -7,14 +8,16 @@
  * Configures the starting velocity, position, and texture origin.
  * @param startPos The exact position where the projectile spawns.
  * @param velocity The directional force (speed) of the projectile.
- * @param texture The sprite texture.
+ * @param texture The sprite texture (an atlas page).
+ * @param textureRect The projectile's image inside that texture.
  */
-Projectile::Projectile(sf::Vector2f startPos, sf::Vector2f velocity, const sf::Texture& texture)
-    : mPos(startPos), mVel(velocity), mIsDead(false), mLifeTime(0.0f)
+Projectile::Projectile(sf::Vector2f startPos, sf::Vector2f velocity, const sf::Texture& texture, const sf::IntRect& textureRect)
+    : mPos(startPos), mPrevPos(startPos), mVel(velocity), mIsDead(false), mLifeTime(0.0f)
 {
     mSprite.setTexture(texture);
+    mSprite.setTextureRect(textureRect);
     // Origin centered for perfect rotation in the air
-    mSprite.setOrigin(texture.getSize().x / 2.0f, texture.getSize().y / 2.0f);
+    mSprite.setOrigin(textureRect.width / 2.0f, textureRect.height / 2.0f);
     mSprite.setPosition(mPos);
 
     // Scale it down to match the world visually
@@ -40,32 +43,65 @@ void Projectile::update(sf::Time dt, World& world) {
     // Uses 400.0f (less than the player's 980.0f) so arrows fly relatively straight and fast
     mVel.y += 400.0f * dt.asSeconds();
 
-    // 3. Move the physical position
-    mPos += mVel * dt.asSeconds();
+    // 3. Move the physical position, stopping at the first solid tile of the path
+    mPrevPos = mPos;
+    mWallHit = world.raycast(mPrevPos, mPos + mVel * dt.asSeconds());
+    mPos = mWallHit.point;
     mSprite.setPosition(mPos);
 
     // 4. Automatic Rotation
     // atan2 calculates the exact angle in radians based on the X and Y velocity vectors
     float angle = std::atan2(mVel.y, mVel.x) * 180.0f / 3.14159265f; // Convert to degrees
     mSprite.setRotation(angle);
+}
 
-    // 5. Collision with the world (Walls/Ground)
-    int gridX = static_cast<int>(std::floor(mPos.x / world.getTileSize()));
-    int gridY = static_cast<int>(std::floor(mPos.y / world.getTileSize()));
+/**
+ * @brief Slab test of the segment mPrevPos -> mPos against the box.
+ */
+bool Projectile::sweepHits(const sf::FloatRect& box, float& time) const {
+    sf::Vector2f delta = mPos - mPrevPos;
+    float entry = 0.0f;
+    float exit = 1.0f;
 
-    // If the arrow hits a solid block
-    if (World::isSolid(world.getBlock(gridX, gridY))) {
-        world.spawnItem(gridX, gridY, ItemID::ARROW); // ¡Sustituido 36 por ItemID::ARROW!
-        mIsDead = true; // Destroy the physical projectile
-    }
+    auto clipAxis = [&](float start, float d, float boxMin, float boxMax) {
+        if (d == 0.0f) return start >= boxMin && start <= boxMax;
+        float t0 = (boxMin - start) / d;
+        float t1 = (boxMax - start) / d;
+        if (t0 > t1) std::swap(t0, t1);
+        entry = std::max(entry, t0);
+        exit = std::min(exit, t1);
+        return entry <= exit;
+    };
+
+    if (!clipAxis(mPrevPos.x, delta.x, box.left, box.left + box.width)) return false;
+    if (!clipAxis(mPrevPos.y, delta.y, box.top, box.top + box.height)) return false;
+
+    time = entry;
+    return true;
+}
+
+/**
+ * @brief Padded by a pixel so a path along an axis (zero width or height) still overlaps what it crosses.
+ */
+sf::FloatRect Projectile::getPathBounds() const {
+    float left = std::min(mPrevPos.x, mPos.x) - 1.0f;
+    float top = std::min(mPrevPos.y, mPos.y) - 1.0f;
+    return sf::FloatRect(left, top, std::abs(mPos.x - mPrevPos.x) + 2.0f, std::abs(mPos.y - mPrevPos.y) + 2.0f);
+}
+
+void Projectile::stickInWall(World& world) {
+    if (!mWallHit.hit) return;
+
+    // The tile the arrow came from (the hit tile itself if it was fired from inside a block)
+    sf::Vector2i dropTile = mWallHit.tile + sf::Vector2i(static_cast<int>(mWallHit.normal.x), static_cast<int>(mWallHit.normal.y));
+    world.spawnItem(dropTile.x, dropTile.y, ItemID::ARROW);
+    mIsDead = true; // Destroy the physical projectile
 }
 
 /**
- * @brief Renders the projectile to the window.
- * @param window The render window.
- * @param lightColor The ambient lighting at its current position.
+ * @brief Queues the projectile for drawing.
+ * @param batch The sprite batch of the current frame.
  */
-void Projectile::render(sf::RenderWindow& window, sf::Color lightColor) {
-    mSprite.setColor(lightColor);
-    window.draw(mSprite);
+void Projectile::render(SpriteBatch& batch) {
+    batch.draw(mSprite, RenderLayer::Projectiles);
 }
\ No newline at end of file
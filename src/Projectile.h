@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "World.h"
+#include "SpriteBatch.h"
 
 /**
  * @class Projectile
@@ -15,23 +16,49 @@ public:
      * @brief Constructs a new Projectile object.
      * @param startPos The initial spawning position (e.g., player's location).
      * @param velocity The initial directional velocity.
-     * @param texture The texture used for rendering the projectile.
+     * @param texture The texture used for rendering the projectile (an atlas page).
+     * @param textureRect The projectile's image inside that texture.
      */
-    Projectile(sf::Vector2f startPos, sf::Vector2f velocity, const sf::Texture& texture);
+    Projectile(sf::Vector2f startPos, sf::Vector2f velocity, const sf::Texture& texture, const sf::IntRect& textureRect);
     
     /**
      * @brief Updates the projectile's physics and orientation.
+     * The path of the step is raycast against the world, so a fast arrow stops
+     * at the first solid tile on its way instead of skipping thin walls. The
+     * arrow only drops once the caller calls stickInWall() (after the mob checks).
      * @param dt Time elapsed since the last frame.
      * @param world Reference to the game world for collision detection against blocks.
      */
     void update(sf::Time dt, World& world);
+
+    /**
+     * @brief Swept test of this step's path (segment) against a box.
+     * @param box The target's bounds (e.g., a mob).
+     * @param time Receives the fraction of the path travelled before entering the box.
+     * @return True if the path enters or starts inside the box.
+     */
+    bool sweepHits(const sf::FloatRect& box, float& time) const;
+
+    /**
+     * @brief Bounding box of this step's path (broadphase for sweepHits()).
+     */
+    sf::FloatRect getPathBounds() const;
+
+    /**
+     * @brief True if this step's path ended against a solid tile.
+     */
+    bool hasHitWall() const { return mWallHit.hit; }
+
+    /**
+     * @brief Drops the arrow in front of the tile it hit and destroys the projectile.
+     */
+    void stickInWall(World& world);
     
     /**
      * @brief Renders the projectile to the window.
-     * @param window The render window.
-     * @param lightColor The current ambient light color.
+     * @param batch The sprite batch of the current frame.
      */
-    void render(sf::RenderWindow& window, sf::Color lightColor);
+    void render(SpriteBatch& batch);
 
     /**
      * @brief Checks if the projectile is dead (hit something or expired).
@@ -64,6 +91,8 @@ public:
 
 private:
     sf::Vector2f mPos;  // Current position in the world
+    sf::Vector2f mPrevPos; // Position at the start of the last step (start of the swept path)
+    World::RaycastHit mWallHit; // Tile that stopped the last step, if any
     sf::Vector2f mVel;  // Current velocity (changes with gravity)
     sf::Sprite mSprite; // Visual representation
     
@@ -0,0 +1,121 @@
+#include "SimplexNoise.h"
+#include <cmath>
+#include "ChunkRng.h"
+
+namespace {
+    // Skew factors between the square grid and the simplex (triangle) grid
+    const float F2 = 0.366025403784439f; // (sqrt(3) - 1) / 2
+    const float G2 = 0.211324865405187f; // (3 - sqrt(3)) / 6
+
+    // Scales the raw sum of the three corner contributions to about [-1, 1]
+    const float OUTPUT_SCALE = 70.0f;
+
+    // Offset between the two warp components so they are uncorrelated
+    const float WARP_OFFSET_X = 31.7f;
+    const float WARP_OFFSET_Y = 47.3f;
+
+    inline int fastFloor(float v) {
+        int i = static_cast<int>(v);
+        return (v < i) ? i - 1 : i;
+    }
+}
+
+SimplexNoise::SimplexNoise(uint64_t seed, int salt) {
+    // Fisher-Yates shuffle of 0-255 driven by the seed
+    for (int i = 0; i < 256; ++i) mPerm[i] = static_cast<uint8_t>(i);
+
+    ChunkRng rng(seed, salt, RngStream::Noise);
+    for (int i = 255; i > 0; --i) {
+        int j = rng.nextInt(i + 1);
+        uint8_t tmp = mPerm[i];
+        mPerm[i] = mPerm[j];
+        mPerm[j] = tmp;
+    }
+    for (int i = 0; i < 256; ++i) mPerm[256 + i] = mPerm[i];
+}
+
+/**
+ * @brief Dot product of the corner offset with one of 8 gradient directions.
+ */
+float SimplexNoise::gradient(int hash, float x, float y) const {
+    // Table lookup instead of a switch keeps the inner loop branch-free
+    static const float GRAD_X[8] = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 0.0f };
+    static const float GRAD_Y[8] = { 1.0f, 1.0f, -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, -1.0f };
+    return GRAD_X[hash & 7] * x + GRAD_Y[hash & 7] * y;
+}
+
+float SimplexNoise::noise(float x, float y) const {
+    // Find the simplex cell containing the point
+    float s = (x + y) * F2;
+    int i = fastFloor(x + s);
+    int j = fastFloor(y + s);
+
+    float t = (i + j) * G2;
+    float x0 = x - (i - t);
+    float y0 = y - (j - t);
+
+    // Upper or lower triangle of the skewed square
+    int i1 = (x0 > y0) ? 1 : 0;
+    int j1 = 1 - i1;
+
+    float x1 = x0 - i1 + G2;
+    float y1 = y0 - j1 + G2;
+    float x2 = x0 - 1.0f + 2.0f * G2;
+    float y2 = y0 - 1.0f + 2.0f * G2;
+
+    int ii = i & 255;
+    int jj = j & 255;
+
+    // Radial falloff contribution of each of the three corners
+    float total = 0.0f;
+
+    float t0 = 0.5f - x0 * x0 - y0 * y0;
+    if (t0 > 0.0f) {
+        t0 *= t0;
+        total += t0 * t0 * gradient(mPerm[ii + mPerm[jj]], x0, y0);
+    }
+
+    float t1 = 0.5f - x1 * x1 - y1 * y1;
+    if (t1 > 0.0f) {
+        t1 *= t1;
+        total += t1 * t1 * gradient(mPerm[ii + i1 + mPerm[jj + j1]], x1, y1);
+    }
+
+    float t2 = 0.5f - x2 * x2 - y2 * y2;
+    if (t2 > 0.0f) {
+        t2 *= t2;
+        total += t2 * t2 * gradient(mPerm[ii + 1 + mPerm[jj + 1]], x2, y2);
+    }
+
+    return OUTPUT_SCALE * total;
+}
+
+float SimplexNoise::fbm(float x, float y, const Fractal& fractal) const {
+    float sum = 0.0f;
+    float amplitude = 1.0f;
+    float amplitudeSum = 0.0f;
+    float frequency = fractal.frequency;
+
+    for (int o = 0; o < fractal.octaves; ++o) {
+        sum += amplitude * noise(x * frequency, y * frequency);
+        amplitudeSum += amplitude;
+        amplitude *= fractal.gain;
+        frequency *= fractal.lacunarity;
+    }
+    return (amplitudeSum > 0.0f) ? sum / amplitudeSum : 0.0f;
+}
+
+void SimplexNoise::fbmBatch(const float* xs, const float* ys, float* out, int count, const Fractal& fractal) const {
+    for (int i = 0; i < count; ++i) {
+        out[i] = fbm(xs[i], ys[i], fractal);
+    }
+}
+
+void SimplexNoise::warpBatch(float* xs, float* ys, int count, float strength, const Fractal& fractal) const {
+    for (int i = 0; i < count; ++i) {
+        float dx = fbm(xs[i], ys[i], fractal);
+        float dy = fbm(xs[i] + WARP_OFFSET_X, ys[i] + WARP_OFFSET_Y, fractal);
+        xs[i] += strength * dx;
+        ys[i] += strength * dy;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @class SimplexNoise
+ * @brief Seeded 2D simplex gradient noise with fBm octaves and domain warping.
+ *
+ * The permutation table is shuffled from the world seed, so each seed gets its
+ * own noise while staying a pure function of (x, y). All methods are const and
+ * safe to call from the generation worker threads.
+ *
+ * The batch functions evaluate whole arrays of sample points at once; the
+ * generator builds the coordinates of a chunk region and fills it in one call.
+ */
+class SimplexNoise {
+public:
+    /**
+     * @brief Octave settings for fractal Brownian motion.
+     */
+    struct Fractal {
+        int octaves = 4;
+        float frequency = 1.0f;  // Frequency of the first octave
+        float lacunarity = 2.0f; // Frequency multiplier per octave
+        float gain = 0.5f;       // Amplitude multiplier per octave
+    };
+
+    /**
+     * @param seed World seed.
+     * @param salt Distinguishes independent noise fields built from the same seed.
+     */
+    SimplexNoise(uint64_t seed, int salt);
+
+    /**
+     * @brief Single octave of simplex noise, roughly in [-1, 1].
+     */
+    float noise(float x, float y) const;
+
+    /**
+     * @brief Sum of octaves, normalized back to roughly [-1, 1].
+     */
+    float fbm(float x, float y, const Fractal& fractal) const;
+
+    /**
+     * @brief out[i] = fbm(xs[i], ys[i]) for count points.
+     */
+    void fbmBatch(const float* xs, const float* ys, float* out, int count, const Fractal& fractal) const;
+
+    /**
+     * @brief Domain warping: displaces every point by this noise field.
+     * xs[i] += strength * fbm(p), ys[i] += strength * fbm(p + offset).
+     * Sampling another field at the warped points gives swirling, organic shapes.
+     */
+    void warpBatch(float* xs, float* ys, int count, float strength, const Fractal& fractal) const;
+
+private:
+    float gradient(int hash, float x, float y) const;
+
+    uint8_t mPerm[512]; // Shuffled 0-255, repeated so lookups never wrap
+};
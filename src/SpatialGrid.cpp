@@ -0,0 +1,110 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize, size_t bucketCount)
+    : mCellSize(cellSize)
+    , mBucketMask(0)
+    , mQueryStamp(0)
+{
+    size_t buckets = 1;
+    while (buckets < bucketCount) buckets <<= 1;
+    mBucketMask = buckets - 1;
+    mBucketStart.assign(buckets + 1, 0);
+}
+
+void SpatialGrid::clear() {
+    mBounds.clear();
+    mEntries.clear(); // Bucket starts are stale until build(); queries see no entries meanwhile
+}
+
+void SpatialGrid::insert(size_t id, const sf::FloatRect& bounds) {
+    if (id >= mBounds.size()) mBounds.resize(id + 1);
+    mBounds[id] = bounds;
+}
+
+int SpatialGrid::cellCoord(float pixels) const {
+    return static_cast<int>(std::floor(pixels / mCellSize));
+}
+
+size_t SpatialGrid::bucketOf(int cellX, int cellY) const {
+    uint32_t h = static_cast<uint32_t>(cellX) * 73856093u ^ static_cast<uint32_t>(cellY) * 19349663u;
+    return h & mBucketMask;
+}
+
+/**
+ * @brief Two passes over the covered cells: count per bucket, prefix-sum, then scatter.
+ */
+void SpatialGrid::build() {
+    std::fill(mBucketStart.begin(), mBucketStart.end(), 0u);
+
+    auto forEachCell = [&](const sf::FloatRect& b, auto visit) {
+        int left = cellCoord(b.left), right = cellCoord(b.left + b.width);
+        int top = cellCoord(b.top), bottom = cellCoord(b.top + b.height);
+        for (int cy = top; cy <= bottom; ++cy) {
+            for (int cx = left; cx <= right; ++cx) visit(bucketOf(cx, cy));
+        }
+    };
+
+    // Count (shifted by one so the prefix sum yields start offsets)
+    for (const sf::FloatRect& b : mBounds) {
+        forEachCell(b, [&](size_t bucket) { mBucketStart[bucket + 1]++; });
+    }
+    for (size_t i = 1; i < mBucketStart.size(); ++i) mBucketStart[i] += mBucketStart[i - 1];
+
+    // Scatter, using a copy of the starts as write cursors
+    mEntries.resize(mBucketStart.back());
+    mCursor.assign(mBucketStart.begin(), mBucketStart.end() - 1);
+    for (size_t id = 0; id < mBounds.size(); ++id) {
+        forEachCell(mBounds[id], [&](size_t bucket) { mEntries[mCursor[bucket]++] = static_cast<uint32_t>(id); });
+    }
+
+    mVisited.assign(mBounds.size(), 0u);
+    mQueryStamp = 0;
+}
+
+template <typename Visit>
+void SpatialGrid::forEachCandidate(const sf::FloatRect& area, Visit visit) {
+    if (mEntries.empty()) return;
+    if (mVisited.size() < mBounds.size()) mVisited.resize(mBounds.size(), 0u);
+
+    if (++mQueryStamp == 0) { // Wrapped: forget every old stamp
+        std::fill(mVisited.begin(), mVisited.end(), 0u);
+        mQueryStamp = 1;
+    }
+
+    int left = cellCoord(area.left), right = cellCoord(area.left + area.width);
+    int top = cellCoord(area.top), bottom = cellCoord(area.top + area.height);
+    for (int cy = top; cy <= bottom; ++cy) {
+        for (int cx = left; cx <= right; ++cx) {
+            size_t bucket = bucketOf(cx, cy);
+            for (uint32_t e = mBucketStart[bucket]; e < mBucketStart[bucket + 1]; ++e) {
+                uint32_t id = mEntries[e];
+                if (id >= mVisited.size() || mVisited[id] == mQueryStamp) continue;
+                mVisited[id] = mQueryStamp;
+                visit(id);
+            }
+        }
+    }
+}
+
+void SpatialGrid::queryRect(const sf::FloatRect& area, std::vector<size_t>& out) {
+    out.clear();
+    forEachCandidate(area, [&](uint32_t id) {
+        if (mBounds[id].intersects(area)) out.push_back(id);
+    });
+    std::sort(out.begin(), out.end());
+}
+
+void SpatialGrid::queryRadius(sf::Vector2f center, float radius, std::vector<size_t>& out) {
+    out.clear();
+    sf::FloatRect area(center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f);
+    forEachCandidate(area, [&](uint32_t id) {
+        // Closest point of the box to the center
+        const sf::FloatRect& b = mBounds[id];
+        float dx = center.x - std::clamp(center.x, b.left, b.left + b.width);
+        float dy = center.y - std::clamp(center.y, b.top, b.top + b.height);
+        if (dx * dx + dy * dy <= radius * radius) out.push_back(id);
+    });
+    std::sort(out.begin(), out.end());
+}
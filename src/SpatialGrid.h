@@ -0,0 +1,79 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform-grid broadphase for entity bounds.
+ *
+ * Entities are added with a dense id (their index in the owner's container)
+ * and their bounds, then build() bins them into square cells. Cells are
+ * hashed into a fixed number of buckets and the entries of all buckets are
+ * stored contiguously (counting sort), so a rebuild allocates nothing once
+ * the arrays have grown to the population. The owner rebuilds the grid after
+ * moving its entities; ids stay valid until the next clear().
+ *
+ * Queries test the exact bounds of the candidates, so hash collisions and
+ * entities spanning several cells never show up in the results. Results are
+ * sorted by id, which keeps the owner's iteration order.
+ */
+class SpatialGrid {
+public:
+    /**
+     * @param cellSize Side of a cell in pixels (a few entity widths works best).
+     * @param bucketCount Number of hash buckets, rounded up to a power of two.
+     */
+    explicit SpatialGrid(float cellSize, size_t bucketCount = 1024);
+
+    /**
+     * @brief Removes every entity.
+     */
+    void clear();
+
+    /**
+     * @brief Adds an entity. Ids must be 0, 1, 2... in insertion order.
+     */
+    void insert(size_t id, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Bins the inserted entities into their cells. Call before querying.
+     */
+    void build();
+
+    /**
+     * @brief Ids of the entities whose bounds intersect a rectangle.
+     * @param out Cleared, then filled in ascending order.
+     */
+    void queryRect(const sf::FloatRect& area, std::vector<size_t>& out);
+
+    /**
+     * @brief Ids of the entities whose bounds intersect a circle.
+     * @param out Cleared, then filled in ascending order.
+     */
+    void queryRadius(sf::Vector2f center, float radius, std::vector<size_t>& out);
+
+    size_t size() const { return mBounds.size(); }
+
+private:
+    int cellCoord(float pixels) const;
+    size_t bucketOf(int cellX, int cellY) const;
+
+    /**
+     * @brief Calls visit(id) once for each entity binned in the cells a rectangle covers.
+     */
+    template <typename Visit>
+    void forEachCandidate(const sf::FloatRect& area, Visit visit);
+
+    float mCellSize;
+    size_t mBucketMask;
+
+    std::vector<sf::FloatRect> mBounds;   // Indexed by id
+    std::vector<uint32_t> mBucketStart;   // Entries of bucket b: [mBucketStart[b], mBucketStart[b + 1])
+    std::vector<uint32_t> mEntries;       // Ids, grouped by bucket
+    std::vector<uint32_t> mCursor;        // Write offsets per bucket while building
+
+    // Per-query de-duplication: an id is reported once per query stamp
+    std::vector<uint32_t> mVisited;
+    uint32_t mQueryStamp;
+};
@@ -0,0 +1,64 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+void SpriteBatch::draw(const sf::Sprite& sprite, RenderLayer layer) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    // Same corner layout as sf::Sprite: the local quad spans the absolute
+    // rect size, a negative rect size flips the texture coordinates
+    sf::IntRect rect = sprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+
+    float texLeft = static_cast<float>(rect.left);
+    float texTop = static_cast<float>(rect.top);
+    float texRight = texLeft + rect.width;
+    float texBottom = texTop + rect.height;
+
+    const sf::Transform& transform = sprite.getTransform();
+    sf::Color color = sprite.getColor();
+
+    Quad quad;
+    quad.layer = layer;
+    quad.texture = texture;
+    quad.vertices[0] = sf::Vertex(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(texLeft, texTop));
+    quad.vertices[1] = sf::Vertex(transform.transformPoint(width, 0.0f), color, sf::Vector2f(texRight, texTop));
+    quad.vertices[2] = sf::Vertex(transform.transformPoint(width, height), color, sf::Vector2f(texRight, texBottom));
+    quad.vertices[3] = sf::Vertex(transform.transformPoint(0.0f, height), color, sf::Vector2f(texLeft, texBottom));
+    mQuads.push_back(quad);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    mDrawCalls = 0;
+
+    // Sort indices, not quads: stable so equal keys keep submission order
+    mOrder.resize(mQuads.size());
+    for (size_t i = 0; i < mOrder.size(); ++i) mOrder[i] = i;
+    std::stable_sort(mOrder.begin(), mOrder.end(), [&](size_t a, size_t b) {
+        if (mQuads[a].layer != mQuads[b].layer) return mQuads[a].layer < mQuads[b].layer;
+        return std::less<const sf::Texture*>()(mQuads[a].texture, mQuads[b].texture);
+    });
+
+    // One draw per run of quads sharing a texture (runs merge across layers)
+    size_t runStart = 0;
+    while (runStart < mOrder.size()) {
+        const sf::Texture* texture = mQuads[mOrder[runStart]].texture;
+        size_t runEnd = runStart;
+        while (runEnd < mOrder.size() && mQuads[mOrder[runEnd]].texture == texture) runEnd++;
+
+        mVertices.resize((runEnd - runStart) * 4);
+        for (size_t i = runStart; i < runEnd; ++i) {
+            const Quad& quad = mQuads[mOrder[i]];
+            for (int v = 0; v < 4; ++v) mVertices[(i - runStart) * 4 + v] = quad.vertices[v];
+        }
+
+        target.draw(mVertices, sf::RenderStates(texture));
+        mDrawCalls++;
+        runStart = runEnd;
+    }
+
+    mQuads.clear();
+}
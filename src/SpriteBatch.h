@@ -0,0 +1,59 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum RenderLayer
+ * @brief Draw order of batched sprites (lower layers are drawn first).
+ */
+enum class RenderLayer : uint8_t {
+    PlayerBody,
+    PlayerArmor,
+    PlayerWeapon,
+    Mobs,
+    Projectiles
+};
+
+/**
+ * @class SpriteBatch
+ * @brief Collects sprites during the render phase and draws them in as few
+ * calls as possible.
+ *
+ * Each submitted sprite is turned into a textured quad (its full transform,
+ * including rotation and flips, is applied on the CPU). flush() sorts the
+ * quads by layer, then by texture, and emits one vertex-array draw per run of
+ * the same texture. Within a layer and texture, submission order is kept.
+ * Sprites of one layer that use different textures may therefore overlap in a
+ * different order than they were submitted.
+ */
+class SpriteBatch {
+public:
+    /**
+     * @brief Queues a sprite (it is copied; the sprite may change afterwards).
+     * Sprites without a texture are ignored.
+     */
+    void draw(const sf::Sprite& sprite, RenderLayer layer);
+
+    /**
+     * @brief Draws every queued sprite and empties the batch.
+     */
+    void flush(sf::RenderTarget& target);
+
+    /**
+     * @brief Draw calls issued by the last flush().
+     */
+    size_t getDrawCallCount() const { return mDrawCalls; }
+
+private:
+    struct Quad {
+        RenderLayer layer;
+        const sf::Texture* texture;
+        sf::Vertex vertices[4];
+    };
+
+    std::vector<Quad> mQuads;
+    std::vector<size_t> mOrder;  // Sorted indices into mQuads
+    sf::VertexArray mVertices{ sf::Quads }; // Reused between runs
+    size_t mDrawCalls = 0;
+};
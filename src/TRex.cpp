@@ -33,7 +33,7 @@ TRex::TRex(sf::Vector2f startPos, const sf::Texture& texture)
     mSprite.setTextureRect(sf::IntRect(0, 0, FRAME_WIDTH, FRAME_HEIGHT));
 }
 
-void TRex::update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) {
+void TRex::update(sf::Time dt, sf::Vector2f playerPos, World& world) {
     float tileSize = world.getTileSize();
     float dtSec = dt.asSeconds();
 
@@ -165,49 +165,28 @@ void TRex::update(sf::Time dt, sf::Vector2f playerPos, World& world, float light
     // =====================================================
     // 4. FÍSICAS, GRAVEDAD Y COLISIONES (NIVEL PRO)
     // =====================================================
-    auto checkCollision = [&](sf::FloatRect rect) -> bool {
-        int left = static_cast<int>(std::floor(rect.left / tileSize));
-        int right = static_cast<int>(std::floor((rect.left + rect.width) / tileSize));
-        int top = static_cast<int>(std::floor(rect.top / tileSize));
-        int bottom = static_cast<int>(std::floor((rect.top + rect.height) / tileSize));
-
-        for (int x = left; x <= right; ++x) {
-            for (int y = top; y <= bottom; ++y) {
-                if (World::isSolid(world.getBlock(x, y))) return true;
-            }
-        }
-        return false;
-    };
+    // Caja de colisión: 60 px de ancho centrada, sin la cresta de la cabeza
+    sf::FloatRect body = mSprite.getGlobalBounds();
+    body.left += (body.width - 60.0f) / 2.0f;
+    body.width = 60.0f;
+    body.top += 10.0f;
+    body.height -= 10.0f;
+
+    // --- 4.1 GRAVEDAD Y MOVIMIENTO BARRIDO (X y luego Y) ---
+    // Sube escalones de un bloque solo si está en el suelo
+    bool wasGrounded = (mVel.y == 0.0f);
+    mVel.y += 1000.0f * dtSec;
+    if (mVel.y > 800.0f) mVel.y = 800.0f;
 
-    // --- 4.1 MOVIMIENTO HORIZONTAL (EJE X) ---
     float dx = mVel.x * dtSec;
-    mPos.x += dx;
+    TileCollision::MoveResult move = world.getCollision().move(body, mVel * dtSec, wasGrounded ? tileSize + 0.5f : 0.0f);
+    mPos += move.offset;
     mSprite.setPosition(mPos);
 
-    sf::FloatRect boundsX = mSprite.getGlobalBounds();
-    boundsX.left += (boundsX.width - 60.0f) / 2.0f;
-    boundsX.width = 60.0f;
-    boundsX.top += 10.0f;
-    boundsX.height -= 35.0f;
-
-    bool hitWallX = false;
-    if (checkCollision(boundsX)) {
-
-        float stepHeight = tileSize + 0.5f;
-        sf::FloatRect stepBounds = boundsX;
-        stepBounds.top -= stepHeight;
+    if (move.hitFloor || move.hitCeiling) mVel.y = 0.0f;
 
-        if (mVel.y == 0.0f && !checkCollision(stepBounds)) {
-            mPos.y -= stepHeight;
-            mSprite.setPosition(mPos);
-        } else {
-            mPos.x -= dx;
-            mSprite.setPosition(mPos);
-
-            if (!mIsRoaring && mVel.y == 0.0f) mVel.y = -700.0f;
-            hitWallX = true;
-        }
-    }
+    bool hitWallX = move.hitWall;
+    if (hitWallX && !mIsRoaring && wasGrounded) mVel.y = -700.0f;
 
     // --- 4.2 LÓGICA DE ATASCO FÍSICO (Muros reales) ---
     if (hitWallX && !mIsFleeing && !mIsRoaring) {
@@ -224,35 +203,6 @@ void TRex::update(sf::Time dt, sf::Vector2f playerPos, World& world, float light
         mStuckTimer = 0.0f;
     }
 
-    // --- 4.3 MOVIMIENTO VERTICAL Y GRAVEDAD (EJE Y) ---
-    mVel.y += 1000.0f * dtSec;
-    if (mVel.y > 800.0f) mVel.y = 800.0f;
-
-    float dy = mVel.y * dtSec;
-    mPos.y += dy;
-    mSprite.setPosition(mPos);
-
-    sf::FloatRect boundsY = mSprite.getGlobalBounds();
-    boundsY.left += (boundsY.width - 60.0f) / 2.0f;
-    boundsY.width = 60.0f;
-
-    if (checkCollision(boundsY)) {
-        if (mVel.y > 0.0f) {
-            int blockY = static_cast<int>(std::floor((boundsY.top + boundsY.height) / tileSize));
-            float newY = blockY * tileSize;
-
-            if (std::abs(mPos.y - newY) < tileSize * 2.0f) mPos.y = newY;
-            else mPos.y -= dy;
-
-            mVel.y = 0.0f;
-
-        } else if (mVel.y < 0.0f) {
-            mPos.y -= dy;
-            mVel.y = 0.0f;
-        }
-        mSprite.setPosition(mPos);
-    }
-
     // =====================================================
     // 5. VISUALES Y ROTACIÓN
     // =====================================================
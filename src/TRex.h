@@ -14,7 +14,7 @@ public:
 
     TRex(sf::Vector2f startPos, const sf::Texture& texture);
 
-    void update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) override;
+    void update(sf::Time dt, sf::Vector2f playerPos, World& world) override;
 
     bool isRoaring() const { return mIsRoaring; }
 
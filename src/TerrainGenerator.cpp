@@ -0,0 +1,541 @@
+#include "TerrainGenerator.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "ChunkRng.h"
+#include "Noise.h"
+#include "World.h"
+#include "Game.h"
+
+namespace {
+    // Gradient-noise settings (coordinates are in blocks)
+    const float BIOME_WARP_STRENGTH = 120.0f; // Blocks a biome border can wander
+    const float CAVE_WARP_STRENGTH = 10.0f;   // Blocks a cave chamber outline can wander
+    const float CAVE_THRESHOLD = 0.38f;       // Density needed to open a chamber near the surface
+    const float CAVE_DEPTH_BONUS = 0.16f;     // Threshold reduction at the bottom (more caves deep down)
+    const int CAVE_CELL = 2;                  // Spacing of the chamber density lattice (blocks)
+
+    SimplexNoise::Fractal makeFractal(int octaves, float frequency) {
+        SimplexNoise::Fractal fractal;
+        fractal.octaves = octaves;
+        fractal.frequency = frequency;
+        return fractal;
+    }
+
+    const SimplexNoise::Fractal HEIGHT_FRACTAL = makeFractal(4, 1.0f / 90.0f);
+    const SimplexNoise::Fractal BIOME_FRACTAL = makeFractal(3, 1.0f / 700.0f);
+    const SimplexNoise::Fractal BIOME_WARP_FRACTAL = makeFractal(2, 1.0f / 300.0f);
+    const SimplexNoise::Fractal CAVE_FRACTAL = makeFractal(3, 1.0f / 24.0f);
+    const SimplexNoise::Fractal CAVE_WARP_FRACTAL = makeFractal(1, 1.0f / 40.0f);
+
+    // Cave smoothing (bit-parallel cellular automaton)
+    const int CAVE_HALO = 2;                           // Columns borrowed from each neighbouring chunk
+    const int CAVE_SPAN = CHUNK_WIDTH + 2 * CAVE_HALO; // Columns simulated per chunk (one bit each)
+    const int CAVE_SMOOTHING_PASSES = 2;               // Each pass invalidates one halo column per side
+    static_assert(CAVE_SPAN <= 32, "Cave span must fit in a 32-bit row");
+    static_assert(CAVE_SMOOTHING_PASSES <= CAVE_HALO, "Smoothing would read past the halo");
+    static_assert(CAVE_HALO % CAVE_CELL == 0, "Halo must start on the density lattice");
+
+    // Trees
+    const int TREE_CANOPY_RADIUS = 2;          // Radius of the leaf ball
+    const int TREE_REACH = TREE_CANOPY_RADIUS; // Columns a tree can reach sideways from its trunk
+
+    /**
+     * @brief Block of a column at height y before caves are carved.
+     */
+    int baseBlock(const TerrainGenerator::Column& column, int y) {
+        // Foreground Solid Blocks
+        if (y >= WORLD_HEIGHT - 2) return ItemID::BEDROCK; // Unbreakable Bedrock bottom layer
+        if (y < column.surfaceY) return ItemID::AIR;
+
+        int depthFromSurface = y - column.surfaceY;
+
+        // Apply biome overlays overrides based on the calculated depth curve
+        if (column.isDesert && depthFromSurface <= column.biomeDepth) return ItemID::SAND; // Desert pocket
+        if (column.isSnow && depthFromSurface <= column.biomeDepth) return ItemID::SNOW;   // Tundra pocket
+
+        // Standard geology generation
+        if (depthFromSurface < 5) return ItemID::DIRT; // Dirt layer
+        return ItemID::STONE;                          // Deep Stone layer
+    }
+
+    inline void fullAdd(uint32_t a, uint32_t b, uint32_t c, uint32_t& sum, uint32_t& carry) {
+        uint32_t partial = a ^ b;
+        sum = partial ^ c;
+        carry = (a & b) | (partial & c);
+    }
+
+    /**
+     * @brief One automaton step for a whole row of bits.
+     * The 8 neighbour counts of every cell are summed at once with a carry-save
+     * adder tree into 4 bit-planes (count = 8*b3 + 4*b2 + 2*b1 + b0).
+     * Rules: more than 4 solid neighbours -> stone, fewer than 4 -> air, exactly 4 -> unchanged.
+     * Only eligible cells change. The outermost bits read zeros past the edge,
+     * which is why every pass consumes one halo column per side.
+     */
+    uint32_t smoothRow(uint32_t up, uint32_t row, uint32_t down, uint32_t eligible) {
+        // Bit c of (r << 1) holds column c - 1; bit c of (r >> 1) holds column c + 1
+        uint32_t s0, c0, s1, c1;
+        fullAdd(up << 1, up, up >> 1, s0, c0);
+        fullAdd(row << 1, row >> 1, down << 1, s1, c1);
+        uint32_t s2 = down ^ (down >> 1);
+        uint32_t c2 = down & (down >> 1);
+
+        // Ones
+        uint32_t b0, c3;
+        fullAdd(s0, s1, s2, b0, c3);
+
+        // Twos (four weight-2 carries)
+        uint32_t t0, t1;
+        fullAdd(c0, c1, c2, t0, t1);
+        uint32_t b1 = t0 ^ c3;
+        uint32_t t2 = t0 & c3;
+
+        // Fours and eights
+        uint32_t b2 = t1 ^ t2;
+        uint32_t b3 = t1 & t2;
+
+        uint32_t moreThanFour = b3 | (b2 & (b1 | b0));
+        uint32_t exactlyFour = b2 & ~b1 & ~b0;
+        uint32_t result = moreThanFour | (exactlyFour & row);
+        return (row & ~eligible) | (result & eligible);
+    }
+}
+
+TerrainGenerator::TerrainGenerator(uint64_t seed)
+    : mSeed(seed)
+    , mWavePhase(static_cast<float>(seed % 65536))
+    , mWaveMode(WaveMode::Batched)
+    , mHeightNoise(seed, 1)
+    , mBiomeNoise(seed, 2)
+    , mCaveNoise(seed, 3)
+    , mWarpNoise(seed, 4)
+{
+}
+
+/**
+ * @brief Procedurally generates a new chunk of terrain.
+ * Uses a combination of Perlin-style noise and cellular automata to carve out biomes,
+ * caves, ore veins, and surface decorations (trees).
+ * @param chunkX The chunk coordinate (X index) to generate.
+ */
+std::unique_ptr<Chunk> TerrainGenerator::generate(int chunkX) const {
+    auto chunk = std::make_unique<Chunk>();
+    advance(*chunk, chunkX, ChunkStage::Complete);
+    return chunk;
+}
+
+/**
+ * @brief Runs the missing stages in pipeline order.
+ * The block layer is unpacked once, edited by every stage, and packed back
+ * into palette storage at the end.
+ */
+void TerrainGenerator::advance(Chunk& chunk, int chunkX, ChunkStage target) const {
+    if (chunk.stage >= target) return;
+
+    bool editsBlocks = (target > ChunkStage::Heightmap);
+    std::vector<int> blocks;
+    if (editsBlocks && chunk.stage >= ChunkStage::Terrain) {
+        blocks = chunk.blocks.toVector();
+    }
+
+    while (chunk.stage < target) {
+        switch (chunk.stage) {
+            case ChunkStage::Empty:
+                buildHeightmap(chunkX, chunk.heights);
+                break;
+            case ChunkStage::Heightmap: {
+                std::vector<int> walls;
+                buildTerrain(chunkX, blocks, walls);
+                chunk.walls.assign(walls);
+                break;
+            }
+            case ChunkStage::Terrain:
+                carveCaves(chunkX, blocks);
+                break;
+            case ChunkStage::Caves:
+                placeOres(chunkX, blocks);
+                break;
+            case ChunkStage::Ores:
+                placeTrees(chunkX, blocks);
+                break;
+            case ChunkStage::Decorated:
+            case ChunkStage::Complete:
+                break; // Nothing left to generate
+        }
+        chunk.stage = static_cast<ChunkStage>(static_cast<int>(chunk.stage) + 1);
+    }
+
+    if (editsBlocks) chunk.blocks.assign(blocks);
+}
+
+/**
+ * @brief Surface elevation and biome of a run of columns.
+ * Pure function of the global X, so chunks can compute their neighbours' columns.
+ */
+void TerrainGenerator::computeColumns(int firstX, int count, Column* out) const {
+    std::vector<float> hillWave(count);
+    std::vector<float> hillDetail(count);
+    std::vector<float> columnX(count);
+    std::vector<float> columnY(count, 0.0f);
+    std::vector<float> surfaceNoise(count);
+    std::vector<float> temperature(count);
+
+    for (int c = 0; c < count; ++c) {
+        int globalX = firstX + c;
+        hillWave[c] = (globalX + mWavePhase) / 50.0f;
+        hillDetail[c] = (globalX + mWavePhase) / 25.0f;
+        columnX[c] = static_cast<float>(globalX);
+    }
+    if (mWaveMode == WaveMode::Batched) {
+        Noise::sinBatch(hillWave.data(), hillWave.data(), count);
+        Noise::sinBatch(hillDetail.data(), hillDetail.data(), count);
+    } else {
+        for (int c = 0; c < count; ++c) {
+            hillWave[c] = std::sin(hillWave[c]);
+            hillDetail[c] = std::sin(hillDetail[c]);
+        }
+    }
+
+    // Surface detail and biome temperature: fBm along the columns.
+    // The biome sample points are domain-warped first so borders meander.
+    mHeightNoise.fbmBatch(columnX.data(), columnY.data(), surfaceNoise.data(), count, HEIGHT_FRACTAL);
+    mWarpNoise.warpBatch(columnX.data(), columnY.data(), count, BIOME_WARP_STRENGTH, BIOME_WARP_FRACTAL);
+    mBiomeNoise.fbmBatch(columnX.data(), columnY.data(), temperature.data(), count, BIOME_FRACTAL);
+
+    for (int c = 0; c < count; ++c) {
+        Column& column = out[c];
+
+        // CALCULATE SURFACE ELEVATION (Rolling hills)
+        float n1 = hillWave[c];
+        float n2 = hillDetail[c] * 0.5f;
+        float baseHeight = 80.0f;
+        column.surfaceY = static_cast<int>(baseHeight + ((n1 + n2) * 10.0f) + surfaceNoise[c] * 14.0f);
+
+        // CALCULATE BIOME "MOISTURE" (Temperature zones)
+        // fBm rarely reaches its extremes, so stretch it to use the full [-1, 1] range
+        float biomeValue = std::clamp(temperature[c] * 1.8f, -1.0f, 1.0f);
+
+        column.isDesert = (biomeValue > 0.5f);
+        column.isSnow = (biomeValue < -0.5f);
+
+        // Calculate specific depth and shape properties for special biomes
+        column.biomeDepth = 0.0f;
+
+        if (column.isDesert) {
+            // Intensity from 0.0 (edge) to 1.0 (center)
+            float intensity = (biomeValue - 0.5f) * 2.0f;
+            // "Bag" shape: Wide and deep, drops sharply (exponent 0.5)
+            column.biomeDepth = 45.0f * std::pow(intensity, 0.5f);
+        }
+        else if (column.isSnow) {
+            float intensity = (std::abs(biomeValue) - 0.5f) * 2.0f;
+            // "V" / "Diamond" shape: Drops down in a straight, pointy angle (exponent 1.2)
+            column.biomeDepth = 45.0f * std::pow(intensity, 1.2f);
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// STAGE: HEIGHTMAP
+// ---------------------------------------------------------
+void TerrainGenerator::buildHeightmap(int chunkX, std::vector<int>& heights) const {
+    Column columns[CHUNK_WIDTH];
+    computeColumns(chunkX * CHUNK_WIDTH, CHUNK_WIDTH, columns);
+
+    heights.resize(CHUNK_WIDTH);
+    for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
+        heights[localX] = columns[localX].surfaceY;
+    }
+}
+
+// ---------------------------------------------------------
+// STAGE: BASE TERRAIN & BIOMES (Deserts and Snow)
+// ---------------------------------------------------------
+void TerrainGenerator::buildTerrain(int chunkX, std::vector<int>& blocks, std::vector<int>& walls) const {
+    Column columns[CHUNK_WIDTH];
+    computeColumns(chunkX * CHUNK_WIDTH, CHUNK_WIDTH, columns);
+
+    int totalBlocks = CHUNK_WIDTH * WORLD_HEIGHT;
+    blocks.assign(totalBlocks, 0);
+    walls.assign(totalBlocks, 0);
+
+    // Fill the vertical columns
+    for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
+        const Column& column = columns[localX];
+
+        for (int y = 0; y < WORLD_HEIGHT; ++y) {
+            int index = y * CHUNK_WIDTH + localX;
+            int bgID = 0;
+
+            // Background Walls (Generated based on depth)
+            if (y > column.surfaceY) {
+                if (y < column.surfaceY + 10) bgID = ItemID::BG_DIRT; // Dirt wall layer
+                else bgID = ItemID::BG_STONE;                         // Deep Stone wall layer
+            }
+
+            blocks[index] = baseBlock(column, y);
+            walls[index] = bgID;
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// STAGE: CAVE SYSTEMS (Worm tunnels + Chambers)
+// ---------------------------------------------------------
+void TerrainGenerator::carveCaves(int chunkX, std::vector<int>& blocks) const {
+    // Caves are simulated over the chunk plus CAVE_HALO columns of each
+    // neighbour: column c of every span array is global X (spanX + c), and the
+    // chunk's own columns start at c = CAVE_HALO.
+    int spanX = chunkX * CHUNK_WIDTH - CAVE_HALO;
+
+    // The halo columns are recomputed from the same pure column profiles the
+    // neighbours use (their Terrain stage), so no neighbour chunk is needed
+    Column columns[CAVE_SPAN];
+    computeColumns(spanX, CAVE_SPAN, columns);
+
+    // 1. Sine fields (batched)
+    // Every worm wave depends on a single coordinate (column, row, or the
+    // diagonal globalX - y), so one SIMD batch per field replaces a std::sin
+    // call per block.
+    const int DIAGONALS = CAVE_SPAN + WORLD_HEIGHT - 1; // Distinct (c - y) values in the span
+    float caveColumn[CAVE_SPAN];
+    float caveRow[WORLD_HEIGHT];
+    float caveDiagonal[DIAGONALS];
+
+    for (int c = 0; c < CAVE_SPAN; ++c) {
+        caveColumn[c] = (spanX + c + mWavePhase) / 20.0f;
+    }
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        caveRow[y] = (y + mWavePhase) / 15.0f;
+    }
+    for (int d = 0; d < DIAGONALS; ++d) {
+        // d = c - y + (WORLD_HEIGHT - 1)
+        caveDiagonal[d] = (spanX + d - (WORLD_HEIGHT - 1)) / 35.0f;
+    }
+
+    const bool batched = (mWaveMode == WaveMode::Batched);
+    if (batched) {
+        Noise::sinBatch(caveColumn, caveColumn, CAVE_SPAN);
+        Noise::cosBatch(caveRow, caveRow, WORLD_HEIGHT);
+        Noise::sinBatch(caveDiagonal, caveDiagonal, DIAGONALS);
+    }
+
+    // 2. Chamber density: warped fBm sampled on a coarse lattice (every CAVE_CELL
+    //    blocks, at global coordinates so neighbouring chunks agree) and
+    //    interpolated bilinearly. Chambers are large, so the detail lost is invisible.
+    const int LATTICE_W = CAVE_SPAN / CAVE_CELL + 1;
+    const int LATTICE_H = (WORLD_HEIGHT + CAVE_CELL - 1) / CAVE_CELL + 1;
+    const int LATTICE_SIZE = LATTICE_W * LATTICE_H;
+    float caveX[LATTICE_SIZE];
+    float caveY[LATTICE_SIZE];
+    float caveLattice[LATTICE_SIZE];
+
+    for (int ly = 0; ly < LATTICE_H; ++ly) {
+        for (int lx = 0; lx < LATTICE_W; ++lx) {
+            caveX[ly * LATTICE_W + lx] = static_cast<float>(spanX + lx * CAVE_CELL);
+            caveY[ly * LATTICE_W + lx] = static_cast<float>(ly * CAVE_CELL);
+        }
+    }
+    mWarpNoise.warpBatch(caveX, caveY, LATTICE_SIZE, CAVE_WARP_STRENGTH, CAVE_WARP_FRACTAL);
+    mCaveNoise.fbmBatch(caveX, caveY, caveLattice, LATTICE_SIZE, CAVE_FRACTAL);
+
+    auto caveDensity = [&](int c, int y) {
+        int lx = c / CAVE_CELL;
+        int ly = y / CAVE_CELL;
+        float fx = static_cast<float>(c % CAVE_CELL) / CAVE_CELL;
+        float fy = static_cast<float>(y % CAVE_CELL) / CAVE_CELL;
+        const float* row = caveLattice + ly * LATTICE_W + lx;
+        float top = row[0] + (row[1] - row[0]) * fx;
+        float bottom = row[LATTICE_W] + (row[LATTICE_W + 1] - row[LATTICE_W]) * fx;
+        return top + (bottom - top) * fy;
+    };
+
+    // 3. Carve raw noise into 1-bit-per-cell bitboards (bit c = span column c).
+    //    Only stone inside the carvable band (10 blocks under the surface down to
+    //    just above the bedrock) is eligible; sand and snow act as a shield.
+    uint32_t solidA[WORLD_HEIGHT];
+    uint32_t solidB[WORLD_HEIGHT];
+    uint32_t eligible[WORLD_HEIGHT];
+
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        uint32_t solidRow = 0;
+        uint32_t eligibleRow = 0;
+
+        for (int c = 0; c < CAVE_SPAN; ++c) {
+            const Column& column = columns[c];
+            int blockID = baseBlock(column, y);
+            bool isSolid = (blockID != ItemID::AIR);
+
+            bool inBand = (y >= column.surfaceY + 10 && y < WORLD_HEIGHT - 5);
+            if (inBand && blockID == ItemID::STONE) {
+                eligibleRow |= 1u << c;
+
+                // A) SPAGHETTI CAVES (Interconnected tunnels)
+                // Combine 3 different sine waves for a chaotic but connected pattern
+                float n1, n2, n3;
+                if (batched) {
+                    n1 = caveColumn[c];
+                    n2 = caveRow[y];
+                    n3 = caveDiagonal[c - y + (WORLD_HEIGHT - 1)];
+                } else {
+                    n1 = std::sin(caveColumn[c]);
+                    n2 = std::cos(caveRow[y]);
+                    n3 = std::sin(caveDiagonal[c - y + (WORLD_HEIGHT - 1)]);
+                }
+                float caveNoise = n1 + n2 + n3;
+
+                // Create a tunnel if the wave values cancel out close to zero
+                bool isWormCave = std::abs(caveNoise) < 0.4f;
+
+                // B) CHAMBERS (Organic rooms, more frequent with depth)
+                float depthFactor = static_cast<float>(y) / WORLD_HEIGHT;
+                bool isChamber = caveDensity(c, y) > CAVE_THRESHOLD - CAVE_DEPTH_BONUS * depthFactor;
+
+                if (isWormCave || isChamber) isSolid = false; // Replace stone with air
+            }
+
+            if (isSolid) solidRow |= 1u << c;
+        }
+
+        solidA[y] = solidRow;
+        eligible[y] = eligibleRow;
+    }
+
+    // 4. Cellular Automata Smoothing (Smooths out jagged edges and floating blocks)
+    // A whole row is updated per step, reading from one buffer and writing
+    // the other. The halo holds the neighbours' real cells, so tunnels continue
+    // seamlessly across chunk borders instead of being walled off.
+    uint32_t* current = solidA;
+    uint32_t* next = solidB;
+    for (int p = 0; p < CAVE_SMOOTHING_PASSES; ++p) {
+        next[0] = current[0];
+        next[WORLD_HEIGHT - 1] = current[WORLD_HEIGHT - 1];
+        for (int y = 1; y < WORLD_HEIGHT - 1; ++y) {
+            next[y] = smoothRow(current[y - 1], current[y], current[y + 1], eligible[y]);
+        }
+        std::swap(current, next);
+    }
+
+    // 5. Write the chunk's own columns back
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
+            uint32_t bit = 1u << (localX + CAVE_HALO);
+            if (!(eligible[y] & bit)) continue;
+            blocks[y * CHUNK_WIDTH + localX] = (current[y] & bit) ? ItemID::STONE : ItemID::AIR;
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// STAGE: ORE VEIN GENERATION
+// ---------------------------------------------------------
+void TerrainGenerator::placeOres(int chunkX, std::vector<int>& blocks) const {
+    ChunkRng oreRng(mSeed, chunkX, RngStream::Ores);
+
+    // Lambda function to "stamp" a circular vein blob into the chunk
+    auto spawnVein = [&](int count, int id, int minDepth, int maxDepth, int sizeProbability) {
+        for (int i = 0; i < count; ++i) {
+            // Choose a random center coordinate within the chunk depth bounds
+            int cx = oreRng.nextInt(CHUNK_WIDTH);
+            int cy = minDepth + oreRng.nextInt(maxDepth - minDepth);
+
+            // Populate a 3x3 area around the center point based on probability
+            for (int vx = -1; vx <= 1; ++vx) {
+                for (int vy = -1; vy <= 1; ++vy) {
+                    if (oreRng.nextInt(100) > sizeProbability) continue;
+
+                    int nx = cx + vx;
+                    int ny = cy + vy;
+
+                    if (nx >= 0 && nx < CHUNK_WIDTH && ny >= 0 && ny < WORLD_HEIGHT) {
+                        int index = ny * CHUNK_WIDTH + nx;
+                        // ONLY overwrite Stone (Do not destroy caves or dirt)
+                        if (blocks[index] == ItemID::STONE) {
+                            blocks[index] = id;
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    // --- ORE CONFIGURATION (Attempts, ID, Min Depth, Max Depth, Spread % ) ---
+    spawnVein(6, ItemID::COAL, 20, 150, 80);
+    spawnVein(4, ItemID::COPPER, 30, 150, 70);
+    spawnVein(3, ItemID::IRON, 50, 150, 70);
+    spawnVein(2, ItemID::COBALT, 100, 150, 50);
+    spawnVein(1, ItemID::TUNGSTEN, 130, 150, 40);
+}
+
+// ---------------------------------------------------------
+// STAGE: SURFACE DECORATIONS (Trees)
+// ---------------------------------------------------------
+/**
+ * @brief Draws every tree that reaches into this chunk, including trees rooted
+ * up to TREE_REACH columns inside a neighbour.
+ * Whether a column grows a tree, and its shape, depend only on the seed and that
+ * column's profile (the neighbour's Terrain stage, recomputed here), so both
+ * chunks draw the same tree and each keeps the blocks that fall inside it.
+ * Trunks replace only air or leaves and leaves only air, which makes the result
+ * independent of the order the trees are drawn in.
+ */
+void TerrainGenerator::placeTrees(int chunkX, std::vector<int>& blocks) const {
+    int firstX = chunkX * CHUNK_WIDTH;
+    int spanX = firstX - TREE_REACH;
+    const int SPAN = CHUNK_WIDTH + 2 * TREE_REACH;
+
+    Column columns[SPAN];
+    computeColumns(spanX, SPAN, columns);
+
+    // Places a block if the cell lies in this chunk and holds one of the replaceable IDs
+    auto placeBlock = [&](int globalX, int y, int id, bool replaceLeaves) {
+        int localX = globalX - firstX;
+        if (localX < 0 || localX >= CHUNK_WIDTH || y <= 0 || y >= WORLD_HEIGHT) return;
+
+        int& cell = blocks[y * CHUNK_WIDTH + localX];
+        if (cell == ItemID::AIR || (replaceLeaves && cell == ItemID::LEAVES)) cell = id;
+    };
+
+    // Round leaf ball (corners cut off)
+    auto drawLeaves = [&](int cx, int cy, int radius) {
+        for (int lx = -radius; lx <= radius; ++lx) {
+            for (int ly = -radius; ly <= radius; ++ly) {
+                if (std::abs(lx) == radius && std::abs(ly) == radius) continue;
+                placeBlock(cx + lx, cy + ly, ItemID::LEAVES, false);
+            }
+        }
+    };
+
+    for (int c = 0; c < SPAN; ++c) {
+        int globalX = spanX + c;
+        const Column& column = columns[c];
+
+        // Trees only grow on plain dirt (not in desert or snow pockets)
+        if (baseBlock(column, column.surfaceY) != ItemID::DIRT) continue;
+        if ((ChunkRng::hash(mSeed, globalX, 0) % 100) >= 10) continue;
+
+        // Each tree draws from its own stream, keyed by its root column
+        ChunkRng treeRng(mSeed, globalX, RngStream::Trees);
+
+        // 1. Trunk height (6 to 14 blocks)
+        int trunkHeight = 6 + treeRng.nextInt(9);
+        int trunkTopY = column.surfaceY - trunkHeight;
+
+        // 2. Straight wooden trunk
+        for (int i = 1; i <= trunkHeight; ++i) {
+            placeBlock(globalX, column.surfaceY - i, ItemID::WOOD, true);
+        }
+
+        // 3. Main canopy, just above the trunk
+        // Its lower edge (2 blocks below the center) ends 1 block above trunkTopY.
+        int canopyCenterY = trunkTopY - 3;
+        drawLeaves(globalX, canopyCenterY, TREE_CANOPY_RADIUS);
+
+        // 3 extra leaves on top to round the canopy off
+        int extraLeavesY = canopyCenterY - TREE_CANOPY_RADIUS - 1;
+        for (int ox = -1; ox <= 1; ++ox) {
+            placeBlock(globalX + ox, extraLeavesY, ItemID::LEAVES, false);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ChunkStore.h"
+#include "SimplexNoise.h"
+
+/**
+ * @class TerrainGenerator
+ * @brief Procedural terrain algorithm (biomes, caves, ores, trees).
+ *
+ * Generation runs as a pipeline of stages (see ChunkStage). advance() is a
+ * pure function of (seed, chunkX, stage): it reads no shared state and writes
+ * only the chunk it is given, so it can run on any thread and the same seed
+ * always produces the same chunk, whether it is built in one go or a few
+ * stages at a time.
+ *
+ * Surface detail, biome temperature and cave chambers are driven by seeded
+ * simplex fBm fields built once per seed.
+ */
+class TerrainGenerator {
+public:
+    /**
+     * @brief Terrain profile of one column.
+     */
+    struct Column {
+        int surfaceY;
+        bool isDesert;
+        bool isSnow;
+        float biomeDepth; // Depth of the sand/snow pocket below the surface
+    };
+
+    /**
+     * @brief How the sine waves of the terrain and worm caves are evaluated.
+     */
+    enum class WaveMode {
+        Batched,       // Noise::sinBatch over per-chunk fields (the game's mode)
+        PerBlockScalar // std::sin per column and per stone cell, as before the batch kernels (benchmark baseline)
+    };
+
+    explicit TerrainGenerator(uint64_t seed);
+
+    /**
+     * @brief Switches the wave evaluation. Only benchmarks use PerBlockScalar:
+     * libm and the batch kernels round differently, so a few cells may differ.
+     */
+    void setWaveMode(WaveMode mode) { mWaveMode = mode; }
+
+    /**
+     * @brief Generates one chunk of terrain (every stage).
+     * @param chunkX The chunk index to generate.
+     * @return The new chunk (not yet stored anywhere).
+     */
+    std::unique_ptr<Chunk> generate(int chunkX) const;
+
+    /**
+     * @brief Runs the stages a chunk is missing, up to and including target.
+     * Does nothing if the chunk is already at target or beyond.
+     * @param chunk The chunk to advance (a new, Empty chunk or a partial one).
+     * @param chunkX The chunk index.
+     * @param target The stage to reach.
+     */
+    void advance(Chunk& chunk, int chunkX, ChunkStage target) const;
+
+    /**
+     * @brief Surface row of each column of a chunk (the Heightmap stage alone).
+     * Also used to restore the heightmap of chunks read back from disk.
+     */
+    void buildHeightmap(int chunkX, std::vector<int>& heights) const;
+
+    uint64_t getSeed() const { return mSeed; }
+
+private:
+    /**
+     * @brief Terrain profiles of count consecutive columns starting at global X firstX.
+     */
+    void computeColumns(int firstX, int count, Column* out) const;
+
+    // --- STAGES ---
+    void buildTerrain(int chunkX, std::vector<int>& blocks, std::vector<int>& walls) const;
+    void carveCaves(int chunkX, std::vector<int>& blocks) const;
+    void placeOres(int chunkX, std::vector<int>& blocks) const;
+    void placeTrees(int chunkX, std::vector<int>& blocks) const;
+
+    uint64_t mSeed;
+    float mWavePhase; // Phase offset of the sine waves (kept small so float precision holds)
+    WaveMode mWaveMode;
+
+    SimplexNoise mHeightNoise; // Surface detail
+    SimplexNoise mBiomeNoise;  // Temperature (desert / snow)
+    SimplexNoise mCaveNoise;   // Chamber density
+    SimplexNoise mWarpNoise;   // Domain warp for biomes and caves
+};
@@ -0,0 +1,137 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    const unsigned PAGE_SIZE = 2048; // Preferred page width and maximum height (pixels)
+    const int PADDING = 2;           // Bleed pixels around every image
+
+    unsigned nextPowerOfTwo(unsigned v) {
+        unsigned p = 1;
+        while (p < v) p <<= 1;
+        return p;
+    }
+
+    /**
+     * @brief Copies source into page at (x, y) and repeats its edge pixels
+     * PADDING times outwards on every side (corners included).
+     */
+    void blitWithBleed(sf::Image& page, const sf::Image& image, const sf::IntRect& source, int x, int y) {
+        for (int py = -PADDING; py < source.height + PADDING; ++py) {
+            int sy = source.top + std::clamp(py, 0, source.height - 1);
+            for (int px = -PADDING; px < source.width + PADDING; ++px) {
+                int sx = source.left + std::clamp(px, 0, source.width - 1);
+                page.setPixel(static_cast<unsigned>(x + px), static_cast<unsigned>(y + py),
+                              image.getPixel(static_cast<unsigned>(sx), static_cast<unsigned>(sy)));
+            }
+        }
+    }
+}
+
+TextureAtlas::TextureAtlas() {
+}
+
+void TextureAtlas::add(int key, const sf::Image& image) {
+    sf::Vector2u size = image.getSize();
+    mImages.push_back(image);
+    mPending.push_back({ key, mImages.size() - 1, sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)) });
+}
+
+void TextureAtlas::addSheet(int firstKey, const sf::Image& sheet, int frameWidth, int frameHeight) {
+    sf::Vector2u size = sheet.getSize();
+    int columns = static_cast<int>(size.x) / frameWidth;
+    int rows = static_cast<int>(size.y) / frameHeight;
+
+    mImages.push_back(sheet);
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < columns; ++col) {
+            sf::IntRect source(col * frameWidth, row * frameHeight, frameWidth, frameHeight);
+            mPending.push_back({ firstKey + row * columns + col, mImages.size() - 1, source });
+        }
+    }
+}
+
+bool TextureAtlas::build() {
+    unsigned pageSize = std::min(PAGE_SIZE, sf::Texture::getMaximumSize());
+    bool allPacked = true;
+
+    // 1. Shelf packing: left to right, a new shelf when the row is full and a
+    //    new page when the page is full. Slots include the bleed border.
+    struct Placement {
+        size_t pending;
+        size_t page;
+        int x, y; // Top-left of the image itself (inside the border)
+    };
+    std::vector<Placement> placements;
+    std::vector<unsigned> pageHeights(1, 0);
+
+    unsigned x = 0;
+    unsigned shelfY = 0;
+    unsigned shelfHeight = 0;
+
+    for (size_t i = 0; i < mPending.size(); ++i) {
+        const sf::IntRect& source = mPending[i].source;
+        unsigned slotW = static_cast<unsigned>(source.width + 2 * PADDING);
+        unsigned slotH = static_cast<unsigned>(source.height + 2 * PADDING);
+
+        if (slotW > pageSize || slotH > pageSize) {
+            std::cerr << "Error: Image " << mPending[i].key << " (" << source.width << "x" << source.height
+                      << ") does not fit in a " << pageSize << " pixel atlas page" << std::endl;
+            allPacked = false;
+            continue;
+        }
+
+        if (x + slotW > pageSize) { // Next shelf
+            shelfY += shelfHeight;
+            x = 0;
+            shelfHeight = 0;
+        }
+        if (shelfY + slotH > pageSize) { // Next page
+            pageHeights.push_back(0);
+            shelfY = 0;
+            x = 0;
+            shelfHeight = 0;
+        }
+
+        placements.push_back({ i, pageHeights.size() - 1, static_cast<int>(x) + PADDING, static_cast<int>(shelfY) + PADDING });
+        x += slotW;
+        shelfHeight = std::max(shelfHeight, slotH);
+        pageHeights.back() = std::max(pageHeights.back(), shelfY + shelfHeight);
+    }
+
+    // 2. Draw every page into an image and upload it
+    std::vector<sf::Image> pageImages(pageHeights.size());
+    for (size_t p = 0; p < pageImages.size(); ++p) {
+        pageImages[p].create(pageSize, nextPowerOfTwo(std::max(1u, pageHeights[p])), sf::Color::Transparent);
+    }
+
+    for (const Placement& placement : placements) {
+        const Pending& pending = mPending[placement.pending];
+        blitWithBleed(pageImages[placement.page], mImages[pending.image], pending.source, placement.x, placement.y);
+    }
+
+    mPages.clear();
+    for (const sf::Image& image : pageImages) {
+        auto page = std::make_unique<sf::Texture>();
+        if (!page->loadFromImage(image)) allPacked = false;
+        mPages.push_back(std::move(page));
+    }
+
+    mRegions.clear();
+    for (const Placement& placement : placements) {
+        const Pending& pending = mPending[placement.pending];
+        Region region;
+        region.texture = mPages[placement.page].get();
+        region.rect = sf::IntRect(placement.x, placement.y, pending.source.width, pending.source.height);
+        mRegions[pending.key] = region;
+    }
+
+    mImages.clear();
+    mPending.clear();
+    return allPacked;
+}
+
+TextureAtlas::Region TextureAtlas::getRegion(int key) const {
+    auto it = mRegions.find(key);
+    return (it != mRegions.end()) ? it->second : Region();
+}
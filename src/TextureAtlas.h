@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TextureAtlas
+ * @brief Packs many small images into a few large textures (pages) with a
+ * rect lookup by key.
+ *
+ * Everything drawn from the same page can share one texture, so tiles, drops
+ * and item icons of different types can go out in a single draw call instead
+ * of one call (and one texture switch) each.
+ *
+ * Every image is surrounded by PADDING pixels that repeat its edge pixels
+ * (bleed), so sampling slightly outside a rect at fractional zoom levels picks
+ * up the image's own border instead of a neighbour: no seams between tiles.
+ *
+ * Usage: add() / addSheet() every image, then build() once. Keys are
+ * caller-defined and must be unique. Images are packed in the order they were
+ * added, so the first ones (World adds the blocks first) share page 0.
+ */
+class TextureAtlas {
+public:
+    /**
+     * @brief Where an image ended up.
+     */
+    struct Region {
+        const sf::Texture* texture = nullptr; // Page holding the image (nullptr if the key is unknown)
+        sf::IntRect rect;                     // Pixel rect inside that page
+    };
+
+    TextureAtlas();
+
+    /**
+     * @brief Queues a whole image for packing.
+     */
+    void add(int key, const sf::Image& image);
+
+    /**
+     * @brief Queues every frame of a sprite sheet as a separate, padded image.
+     * Frame (col, row) gets key firstKey + row * columns + col.
+     */
+    void addSheet(int firstKey, const sf::Image& sheet, int frameWidth, int frameHeight);
+
+    /**
+     * @brief Packs the queued images (shelf packing) and uploads the pages.
+     * @return False if an image is larger than a page (it is left out).
+     */
+    bool build();
+
+    bool contains(int key) const { return mRegions.count(key) != 0; }
+
+    /**
+     * @brief Page and rect of an image (empty region if the key is unknown).
+     */
+    Region getRegion(int key) const;
+
+    size_t getPageCount() const { return mPages.size(); }
+    const sf::Texture* getPage(size_t index) const { return mPages[index].get(); }
+
+private:
+    struct Pending {
+        int key;
+        size_t image;       // Index into mImages
+        sf::IntRect source; // Part of that image to pack
+    };
+
+    std::vector<sf::Image> mImages; // Source images, released after build()
+    std::vector<Pending> mPending;
+    std::unordered_map<int, Region> mRegions;
+    std::vector<std::unique_ptr<sf::Texture>> mPages; // unique_ptr: Region::texture stays valid
+};
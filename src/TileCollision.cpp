@@ -0,0 +1,184 @@
+#include "TileCollision.h"
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    const float INF = std::numeric_limits<float>::infinity();
+
+    /**
+     * One axis of the swept box against one axis of a tile. Entry/exit are
+     * fractions of the motion; separated tells whether the box starts outside
+     * the tile (or touching it) on this axis. Returns false if the tile can
+     * never be reached on this axis (no motion and no overlap).
+     */
+    bool sweepAxis(float boxMin, float boxMax, float tileMin, float tileMax, float delta,
+                   float& entry, float& exit, bool& separated) {
+        const float eps = TileCollision::EPSILON;
+        if (delta == 0.0f) {
+            entry = -INF;
+            exit = INF;
+            separated = false;
+            return boxMin < tileMax - eps && boxMax > tileMin + eps;
+        }
+
+        // Distances travelled along the motion until the faces meet and part
+        float entryDist = (delta > 0.0f) ? tileMin - boxMax : boxMin - tileMax;
+        float exitDist = (delta > 0.0f) ? tileMax - boxMin : boxMax - tileMin;
+        float speed = std::abs(delta);
+
+        separated = entryDist >= -eps;
+        entry = (separated ? std::max(entryDist, 0.0f) : entryDist) / speed;
+        exit = (exitDist - eps) / speed;
+        return true;
+    }
+
+    /**
+     * Solid bits of one chunk row as seen by collision: chunks that are not
+     * resident and Complete are full, rows outside the world are empty.
+     */
+    uint16_t solidRow(const Chunk* chunk, int y) {
+        if (y < 0 || y >= WORLD_HEIGHT) return 0;
+        if (!chunk || chunk->stage != ChunkStage::Complete) return 0xFFFF;
+        return chunk->solid[y];
+    }
+}
+
+TileCollision::TileCollision(ChunkStore& chunks, float tileSize)
+    : mChunks(chunks)
+    , mTileSize(tileSize)
+{
+}
+
+bool TileCollision::isSolidTile(int x, int y) const {
+    return (solidRow(mChunks.find(x >> CHUNK_SHIFT), y) >> (x & CHUNK_MASK)) & 1u;
+}
+
+bool TileCollision::overlapsSolid(const sf::FloatRect& box) const {
+    int left = static_cast<int>(std::floor((box.left + EPSILON) / mTileSize));
+    int right = static_cast<int>(std::floor((box.left + box.width - EPSILON) / mTileSize));
+    int top = static_cast<int>(std::floor((box.top + EPSILON) / mTileSize));
+    int bottom = static_cast<int>(std::floor((box.top + box.height - EPSILON) / mTileSize));
+
+    // One masked word per chunk row
+    for (int x = left; x <= right; ) {
+        int firstCol = x & CHUNK_MASK;
+        int lastCol = std::min(CHUNK_WIDTH - 1, firstCol + (right - x));
+        const Chunk* chunk = mChunks.find(x >> CHUNK_SHIFT);
+        uint16_t mask = chunkColumnMask(firstCol, lastCol);
+
+        for (int y = top; y <= bottom; ++y) {
+            if (solidRow(chunk, y) & mask) return true;
+        }
+        x += lastCol - firstCol + 1;
+    }
+    return false;
+}
+
+TileCollision::SweepHit TileCollision::sweep(const sf::FloatRect& box, sf::Vector2f motion) const {
+    SweepHit result;
+    if (motion.x == 0.0f && motion.y == 0.0f) return result;
+
+    // Broadphase: every tile touched by the box at any point of the motion.
+    // Closed bounds on purpose: a tile exactly at the leading face must be
+    // seen even when the motion is shorter than EPSILON.
+    float minX = std::min(box.left, box.left + motion.x);
+    float maxX = std::max(box.left, box.left + motion.x) + box.width;
+    float minY = std::min(box.top, box.top + motion.y);
+    float maxY = std::max(box.top, box.top + motion.y) + box.height;
+
+    int left = static_cast<int>(std::floor(minX / mTileSize));
+    int right = static_cast<int>(std::floor(maxX / mTileSize));
+    int top = static_cast<int>(std::floor(minY / mTileSize));
+    int bottom = static_cast<int>(std::floor(maxY / mTileSize));
+
+    float bestTime = INF;
+    auto testTile = [&](int x, int y) {
+        float tileLeft = x * mTileSize;
+        float tileTop = y * mTileSize;
+
+        float entryX, exitX, entryY, exitY;
+        bool separatedX, separatedY;
+        if (!sweepAxis(box.left, box.left + box.width, tileLeft, tileLeft + mTileSize, motion.x,
+                       entryX, exitX, separatedX)) return;
+        if (!sweepAxis(box.top, box.top + box.height, tileTop, tileTop + mTileSize, motion.y,
+                       entryY, exitY, separatedY)) return;
+
+        // Already inside the tile: let the box move out freely
+        if (!separatedX && !separatedY) return;
+
+        float entry = std::max(entryX, entryY);
+        float exit = std::min(exitX, exitY);
+        if (entry > exit || entry > 1.0f || entry >= bestTime) return;
+
+        bestTime = entry;
+        result.hit = true;
+        result.time = entry;
+        result.tile = sf::Vector2i(x, y);
+        if (entryX > entryY) result.normal = sf::Vector2f(motion.x > 0.0f ? -1.0f : 1.0f, 0.0f);
+        else result.normal = sf::Vector2f(0.0f, motion.y > 0.0f ? -1.0f : 1.0f);
+    };
+
+    // Rows are filtered a chunk-wide word at a time; only solid bits reach the exact test
+    for (int x = left; x <= right; ) {
+        int firstCol = x & CHUNK_MASK;
+        int lastCol = std::min(CHUNK_WIDTH - 1, firstCol + (right - x));
+        int chunkX = x >> CHUNK_SHIFT;
+        const Chunk* chunk = mChunks.find(chunkX);
+        uint16_t mask = chunkColumnMask(firstCol, lastCol);
+
+        for (int y = top; y <= bottom; ++y) {
+            uint16_t bits = solidRow(chunk, y) & mask;
+            for (int lx = firstCol; bits != 0 && lx <= lastCol; ++lx) {
+                if ((bits >> lx) & 1u) testTile(chunkX * CHUNK_WIDTH + lx, y);
+            }
+        }
+        x += lastCol - firstCol + 1;
+    }
+    return result;
+}
+
+TileCollision::MoveResult TileCollision::move(const sf::FloatRect& box, sf::Vector2f motion, float stepHeight) const {
+    MoveResult result;
+    sf::FloatRect current = box;
+
+    // --- X AXIS ---
+    if (motion.x != 0.0f) {
+        SweepHit hit = sweep(current, sf::Vector2f(motion.x, 0.0f));
+
+        // Auto-step: lift the box, carry it across, then lower it onto the ledge
+        if (hit.hit && stepHeight > 0.0f && !sweep(current, sf::Vector2f(0.0f, -stepHeight)).hit) {
+            sf::FloatRect lifted = current;
+            lifted.top -= stepHeight;
+            if (!sweep(lifted, sf::Vector2f(motion.x, 0.0f)).hit) {
+                lifted.left += motion.x;
+                lifted.top += stepHeight * sweep(lifted, sf::Vector2f(0.0f, stepHeight)).time;
+                current = lifted;
+                result.stepped = true;
+            }
+        }
+
+        if (!result.stepped) {
+            current.left += motion.x * hit.time;
+            result.hitWall = hit.hit;
+        }
+    }
+
+    // --- Y AXIS ---
+    if (motion.y != 0.0f) {
+        SweepHit hit = sweep(current, sf::Vector2f(0.0f, motion.y));
+        current.top += motion.y * hit.time;
+        if (hit.hit) {
+            if (motion.y > 0.0f) result.hitFloor = true;
+            else result.hitCeiling = true;
+        }
+    }
+
+    result.offset = sf::Vector2f(current.left - box.left, current.top - box.top);
+    return result;
+}
+
+bool TileCollision::isOnGround(const sf::FloatRect& box, float probeDepth) const {
+    return overlapsSolid(sf::FloatRect(box.left, box.top + box.height, box.width, probeDepth));
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "ChunkStore.h"
+
+/**
+ * @class TileCollision
+ * @brief Axis-aligned box collision against the solid tiles of the world.
+ *
+ * Boxes are swept along their motion instead of being tested only at their
+ * destination, so fast movers stop at the first tile face in their way and
+ * report when (fraction of the motion) and on which face they touched it.
+ * Tiles are read from the resident chunks' solid bitsets (Chunk::solid), one
+ * masked word per chunk row, so empty rows are skipped whole. A tile whose
+ * chunk is not resident and Complete counts as solid, so entities wait at the
+ * edge of the generated terrain instead of falling through it. Rows above and
+ * below the world are open.
+ *
+ * Touching faces do not collide (a box resting on the floor slides along it
+ * freely) and tiles a box already overlaps are ignored, so an entity stuck in
+ * a freshly placed block can walk out of it. Both rules use a small tolerance
+ * (EPSILON) to absorb float rounding of positions.
+ */
+class TileCollision {
+public:
+    static constexpr float EPSILON = 0.01f; // Pixels of overlap/gap treated as touching
+
+    /**
+     * @struct SweepHit
+     * @brief First contact of a swept box.
+     */
+    struct SweepHit {
+        bool hit = false;
+        float time = 1.0f;    // Fraction of the motion travelled before contact (1 if none)
+        sf::Vector2f normal;  // Face normal of the tile hit, pointing back at the box (zero if none)
+        sf::Vector2i tile;    // Grid coordinates of the tile hit
+    };
+
+    /**
+     * @struct MoveResult
+     * @brief Outcome of move(): how far the box went and what stopped it.
+     */
+    struct MoveResult {
+        sf::Vector2f offset;     // Displacement actually applied to the box
+        bool hitWall = false;    // Horizontal motion was blocked (after trying to step up)
+        bool hitFloor = false;   // Downward motion was blocked: the box landed
+        bool hitCeiling = false; // Upward motion was blocked
+        bool stepped = false;    // The box climbed a ledge instead of stopping at it
+    };
+
+    TileCollision(ChunkStore& chunks, float tileSize);
+
+    /**
+     * @brief True if the tile at grid (x, y) blocks movement.
+     */
+    bool isSolidTile(int x, int y) const;
+
+    /**
+     * @brief True if the box overlaps (by more than EPSILON) any solid tile.
+     */
+    bool overlapsSolid(const sf::FloatRect& box) const;
+
+    /**
+     * @brief Sweeps a box along a motion and finds the first solid tile face it touches.
+     */
+    SweepHit sweep(const sf::FloatRect& box, sf::Vector2f motion) const;
+
+    /**
+     * @brief Moves a box horizontally, then vertically, stopping each axis at the first contact.
+     * @param stepHeight Tallest ledge the box climbs when walking into it (0 disables stepping).
+     * A step lifts the box, moves it across and lowers it back onto the ledge in the same move.
+     */
+    MoveResult move(const sf::FloatRect& box, sf::Vector2f motion, float stepHeight = 0.0f) const;
+
+    /**
+     * @brief True if solid ground lies within probeDepth pixels under the box.
+     */
+    bool isOnGround(const sf::FloatRect& box, float probeDepth = 2.0f) const;
+
+private:
+    ChunkStore& mChunks;
+    float mTileSize;
+};
@@ -27,9 +27,8 @@ Troodon::Troodon(sf::Vector2f startPos, const sf::Texture& texture)
  * @param dt Time elapsed since the last frame.
  * @param playerPos The player's current position to track and attack.
  * @param world Reference to the game world for collision detection.
- * @param lightLevel The current ambient light level for coloring.
  */
-void Troodon::update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) {
+void Troodon::update(sf::Time dt, sf::Vector2f playerPos, World& world) {
     float dtSec = dt.asSeconds();
     if (mDamageTimer > 0.0f) mDamageTimer -= dtSec;
     if (mAttackCooldown > 0.0f) mAttackCooldown -= dtSec;
@@ -55,8 +54,11 @@ void Troodon::update(sf::Time dt, sf::Vector2f playerPos, World& world, float li
         }
     }
     else {
-        // Attack range check
-        if (std::abs(distX) < 70.0f && std::abs(distY) < 50.0f && mAttackCooldown <= 0.0f) {
+        // Attack range check (no biting through walls)
+        sf::FloatRect body = getBounds();
+        sf::Vector2f head(body.left + body.width / 2.0f, body.top + body.height / 2.0f);
+        if (std::abs(distX) < 70.0f && std::abs(distY) < 50.0f && mAttackCooldown <= 0.0f &&
+            world.hasLineOfSight(head, playerPos)) {
             mIsAttacking = true;
             mAttackDuration = 0.4f; // Quick lethal bite
             mFacingRight = (distX > 0);
@@ -79,75 +81,41 @@ void Troodon::update(sf::Time dt, sf::Vector2f playerPos, World& world, float li
     // ==========================================
     // 2. PRO PHYSICS AND ANTICIPATION SENSOR
     // ==========================================
-    auto checkCollision = [&](sf::FloatRect rect) {
-        int left = static_cast<int>(std::floor(rect.left / world.getTileSize()));
-        int right = static_cast<int>(std::floor((rect.left + rect.width) / world.getTileSize()));
-        int top = static_cast<int>(std::floor(rect.top / world.getTileSize()));
-        int bottom = static_cast<int>(std::floor((rect.top + rect.height) / world.getTileSize()));
-        for (int x = left; x <= right; ++x) {
-            for (int y = top; y <= bottom; ++y) {
-                if (World::isSolid(world.getBlock(x, y))) return true;
-            }
-        }
-        return false;
-    };
+    const TileCollision& collision = world.getCollision();
 
     // --- REAL GROUND DETECTOR ---
-    sf::FloatRect groundSensor = getBounds();
-    groundSensor.top += groundSensor.height;
-    groundSensor.height = 2.0f;
-    bool isGrounded = (mVel.y >= 0.0f && checkCollision(groundSensor));
-
-    float dx = mVel.x * dtSec;
-    mPos.x += dx;
-    mSprite.setPosition(mPos);
-
-    sf::FloatRect boundsX = getBounds();
-    boundsX.height -= 15.0f; // Cut the ankles for easier stepping
+    bool isGrounded = (mVel.y >= 0.0f && collision.isOnGround(getBounds()));
 
     // --- VISUAL ANTICIPATION SENSOR (Jump over obstacles) ---
     if (isGrounded && std::abs(mVel.x) > 0.0f) {
-        sf::FloatRect sensor = boundsX;
+        sf::FloatRect sensor = getBounds();
+        sensor.height -= 15.0f; // Cut the ankles so the floor itself is not an obstacle
         sensor.left += (mVel.x > 0) ? 25.0f : -25.0f; // Look ahead
 
-        if (checkCollision(sensor)) {
+        if (collision.overlapsSolid(sensor)) {
             mVel.y = -380.0f;
             isGrounded = false; // Take off!
         }
     }
 
-    // Real physical collision X
-    if (checkCollision(boundsX)) {
-        mPos.x -= dx;
-        if (isGrounded) {
-            mVel.y = -380.0f;
-            isGrounded = false;
-        }
-        mSprite.setPosition(mPos);
-    }
-
-    // Gravity Y
+    // Gravity
     mVel.y += 1000.0f * dtSec;
     if (mVel.y > 800.0f) mVel.y = 800.0f; // Terminal velocity
-    float dy = mVel.y * dtSec;
-    mPos.y += dy;
+
+    // Real physical collision (swept, X then Y)
+    TileCollision::MoveResult move = collision.move(getBounds(), mVel * dtSec);
+    mPos += move.offset;
     mSprite.setPosition(mPos);
 
-    sf::FloatRect boundsY = getBounds();
-    // Real physical collision Y
-    if (checkCollision(boundsY)) {
-        if (mVel.y > 0.0f) { // Hitting ground
-            int blockY = static_cast<int>(std::floor((boundsY.top + boundsY.height) / world.getTileSize()));
-            float newY = blockY * world.getTileSize();
-            if (std::abs(mPos.y - newY) < world.getTileSize() * 2.0f) mPos.y = newY;
-            else mPos.y -= dy;
-            mVel.y = 0.0f;
-            isGrounded = true; // Lands
-        } else if (mVel.y < 0.0f) { // Hitting ceiling
-            mPos.y -= dy;
-            mVel.y = 0.0f;
-        }
-        mSprite.setPosition(mPos);
+    if (move.hitFloor) {
+        mVel.y = 0.0f;
+        isGrounded = true; // Lands
+    } else if (move.hitCeiling) {
+        mVel.y = 0.0f;
+    }
+    if (move.hitWall && isGrounded) {
+        mVel.y = -380.0f;
+        isGrounded = false;
     }
 
     // ==========================================
@@ -173,16 +141,7 @@ void Troodon::update(sf::Time dt, sf::Vector2f playerPos, World& world, float li
     // Visuals and damage tint
     float currentScale = std::abs(mSprite.getScale().y);
     mSprite.setScale(mFacingRight ? currentScale : -currentScale, currentScale);
-    if (mDamageTimer > 0.0f) {
-        mSprite.setColor(sf::Color::Red);
-    } else {
-        // Base color affected by world lighting, but a bit brighter so it's not invisible at night
-        mSprite.setColor(sf::Color(
-            std::min(255, (int)(255 * lightLevel) + 20),
-            std::min(255, (int)(255 * lightLevel) + 20),
-            std::min(255, (int)(255 * lightLevel) + 20)
-        ));
-    }
+    mSprite.setColor((mDamageTimer > 0.0f) ? sf::Color::Red : sf::Color::White);
 }
 
 // ==========================================
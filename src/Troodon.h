@@ -28,9 +28,8 @@ public:
      * @param dt Time elapsed since the last frame.
      * @param playerPos The current position of the player (for tracking).
      * @param world Reference to the game world for collision detection.
-     * @param lightLevel The current ambient light level.
      */
-    void update(sf::Time dt, sf::Vector2f playerPos, World& world, float lightLevel) override;
+    void update(sf::Time dt, sf::Vector2f playerPos, World& world) override;
 
     /**
      * @brief Gets the collision bounding box for the Troodon.
@@ -0,0 +1,28 @@
+#include "UIPanel.h"
+
+bool UIPanel::beginUpdate(sf::Vector2u size) {
+    if (size.x == 0 || size.y == 0) return false;
+
+    if (mTexture.getSize() != size) {
+        if (!mTexture.create(size.x, size.y)) return false;
+        mDirty = true;
+    }
+    if (!mDirty) return false;
+
+    mTexture.setView(sf::View(sf::FloatRect(0.0f, 0.0f, static_cast<float>(size.x), static_cast<float>(size.y))));
+    mTexture.clear(sf::Color::Transparent);
+    return true;
+}
+
+void UIPanel::endUpdate() {
+    mTexture.display();
+    mSprite.setTexture(mTexture.getTexture(), true);
+    mDirty = false;
+}
+
+void UIPanel::draw(sf::RenderTarget& target) const {
+    if (mDirty) return; // Never drawn (or the texture could not be created)
+
+    sf::RenderStates states(sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha));
+    target.draw(mSprite, states);
+}
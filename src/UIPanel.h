@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @class UIPanel
+ * @brief Screen-space UI layer cached in a render texture.
+ *
+ * The owner redraws the panel's content only after invalidate() (or when the
+ * window size changes) and otherwise blits the cached texture with a single
+ * draw. The texture is cleared to transparent and drawn with normal alpha
+ * blending, so its pixels end up premultiplied by alpha; draw() composites
+ * them with a premultiplied blend mode, which gives the same result as
+ * drawing the content directly onto the target.
+ */
+class UIPanel {
+public:
+    /**
+     * @brief Marks the cached content as stale (the next beginUpdate() returns true).
+     */
+    void invalidate() { mDirty = true; }
+
+    /**
+     * @brief Starts a redraw if the cache is stale or the size changed.
+     * @param size Size of the panel in pixels (the window size for full-screen panels).
+     * @return True if the caller must draw the content into getTarget() and then call endUpdate().
+     */
+    bool beginUpdate(sf::Vector2u size);
+
+    /**
+     * @brief Render target of the cache, with a view matching window pixel coordinates.
+     */
+    sf::RenderTarget& getTarget() { return mTexture; }
+
+    /**
+     * @brief Finishes a redraw started by beginUpdate().
+     */
+    void endUpdate();
+
+    /**
+     * @brief Draws the cached content at the origin of the target's current view.
+     */
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    sf::RenderTexture mTexture;
+    sf::Sprite mSprite;
+    bool mDirty = true;
+};
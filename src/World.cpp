@@ -2,16 +2,121 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <limits>
 #include "Game.h"
 
+namespace {
+    // Per-world cache for chunks evicted while modified
+    const char* CHUNK_CACHE_DIR = "world_cache";
+
+    // Atlas keys: icons use their ItemID, the other image kinds are offset past every ItemID
+    const int HELD_ATLAS_KEY = 1 << 16;
+    const int ARMOR_ATLAS_KEY = 2 << 16;
+    const int AUTOTILE_ATLAS_KEY = 3 << 16; // + ItemID * AUTOTILE_FRAMES + mask
+    const int AUTOTILE_FRAMES = 16;         // 4x4 frames per sheet, one per neighbour mask
+
+    // Dropped items
+    const float MAGNET_RANGE = 125.0f;
+    const float PICKUP_RANGE = 30.0f;
+    const float MAGNET_FORCE = 40.0f;
+    const float DROP_SLEEP_DELAY = 0.5f; // Seconds before a grounded drop may sleep (also the magnet delay)
+    const float DROP_SLEEP_SPEED = 5.0f; // Horizontal speed under which a grounded drop sleeps
+
+    // Darkest a tile gets without torches (keeps deep caves faintly visible)
+    const float MIN_AMBIENT = 5.0f;
+
+    static_assert(WORLD_HEIGHT <= 255, "Chunk::skyTop stores rows as uint8_t");
+
+    /**
+     * @brief Autotile mask of a block from its 4 neighbours (1 = top, 2 = right, 4 = bottom, 8 = left).
+     */
+    int autotileMask(int targetID, int top, int right, int bottom, int left) {
+        auto connects = [&](int neighbor) {
+            // Always connect seamlessly with the same block
+            if (neighbor == targetID) return true;
+
+            // Dirt and leaves merge with every block except air and torches
+            if (targetID == ItemID::DIRT || targetID == ItemID::LEAVES) {
+                return neighbor != ItemID::AIR && neighbor != ItemID::TORCH;
+            }
+            return false;
+        };
+
+        int mask = 0;
+        if (connects(top))    mask += 1;
+        if (connects(right))  mask += 2;
+        if (connects(bottom)) mask += 4;
+        if (connects(left))   mask += 8;
+        return mask;
+    }
+
+    std::string spillPath(int chunkX) {
+        return std::string(CHUNK_CACHE_DIR) + "/chunk_" + std::to_string(chunkX) + ".bin";
+    }
+
+    // Chunk record shared by save files and the spill cache: blocks then walls,
+    // each as CHUNK_WIDTH * WORLD_HEIGHT plain ints.
+    void writeChunkData(std::ostream& file, const Chunk& chunk) {
+        std::vector<int> blocks = chunk.blocks.toVector();
+        std::vector<int> walls = chunk.walls.toVector();
+        file.write(reinterpret_cast<const char*>(blocks.data()), blocks.size() * sizeof(int));
+        file.write(reinterpret_cast<const char*>(walls.data()), walls.size() * sizeof(int));
+    }
+
+    // Reads the two layers of a record; the chunk is left untouched on a short read.
+    bool readChunkLayers(std::istream& file, Chunk& chunk) {
+        std::vector<int> blocks(CHUNK_WIDTH * WORLD_HEIGHT);
+        std::vector<int> walls(CHUNK_WIDTH * WORLD_HEIGHT);
+        file.read(reinterpret_cast<char*>(blocks.data()), blocks.size() * sizeof(int));
+        file.read(reinterpret_cast<char*>(walls.data()), walls.size() * sizeof(int));
+        if (!file) return false;
+
+        chunk.blocks.assign(blocks);
+        chunk.walls.assign(walls);
+        return true;
+    }
+
+    // The heightmap is not stored: it is rebuilt from the seed so a loaded
+    // chunk carries every stage's data like a generated one.
+    void finishLoadedChunk(Chunk& chunk, const TerrainGenerator& terrain, int chunkX) {
+        terrain.buildHeightmap(chunkX, chunk.heights);
+        chunk.stage = ChunkStage::Complete;
+    }
+
+    bool readChunkData(std::istream& file, Chunk& chunk, const TerrainGenerator& terrain, int chunkX) {
+        if (!readChunkLayers(file, chunk)) return false;
+        finishLoadedChunk(chunk, terrain, chunkX);
+        return true;
+    }
+}
+
 /**
  * @brief Constructor for the World class.
  * Initializes the tile size and triggers the loading of all block and item textures.
  */
-World::World()
+World::World(uint64_t seed)
     : mTileSize(32.0f)
+    , mGenerator(seed)
+    , mAsyncGenerated(0)
+    , mSyncGenerated(0)
+    , mPartialGenerated(0)
+    , mLight(mChunks)
+    , mCollision(mChunks, mTileSize)
+    , mResidentBudget(DEFAULT_RESIDENT_CHUNKS)
+    , mFrameCounter(0)
+    , mEvictionCount(0)
+    , mEvictionsThisWindow(0)
+    , mEvictionWindowTimer(0.0f)
+    , mEvictionRate(0.0f)
+    , mDrawCalls(0)
 {
     loadTextures();
+
+    // Spill files from a previous session belong to a world that no longer exists
+    clearChunkCache();
 }
 
 // ==========================================
@@ -23,303 +128,38 @@ World::World()
  * If the requested chunk is not currently in memory, it is generated on the fly.
  * @param x Global X coordinate (in blocks).
  * @param y Global Y coordinate (in blocks).
+ * @param stage Generation stage the chunk must have reached.
  * @return The ItemID of the block, or 0 (Air) if out of vertical bounds.
  */
-int World::getBlock(int x, int y) {
+int World::getBlock(int x, int y, ChunkStage stage) {
     // Boundary Check: Ensure Y is within the world height limits
     if (y < 0 || y >= WORLD_HEIGHT) {
         return 0; // Air outside vertical limits
     }
 
-    // Calculate Chunk Index
-    // std::floor ensures negative coordinates are grouped correctly (e.g., x=-5 belongs to chunk -1)
-    int chunkIndex = static_cast<int>(std::floor(x / (float)CHUNK_WIDTH));
-
-    // Check memory: generate the chunk if it doesn't exist yet
-    if (mChunks.find(chunkIndex) == mChunks.end()) {
-        generateChunk(chunkIndex);
-    }
-
-    // Retrieve the specific block from the chunk's 1D vector array.
-    // The modulo operator wraps negative local coordinates into the 0-15 range safely.
-    int localX = (x % CHUNK_WIDTH + CHUNK_WIDTH) % CHUNK_WIDTH;
-    int index = y * CHUNK_WIDTH + localX;
-
-    return mChunks[chunkIndex][index];
+    // Shift/mask split the global X into chunk index and local column
+    // (negative coordinates land in the right chunk, e.g. x=-5 -> chunk -1, column 11).
+    // getChunk generates the chunk on the fly if it doesn't exist yet.
+    const Chunk& chunk = getChunk(x >> CHUNK_SHIFT, stage);
+    return chunk.blocks.get(y * CHUNK_WIDTH + (x & CHUNK_MASK));
 }
 
 /**
- * @brief Procedurally generates a new chunk of terrain.
- * Uses a combination of Perlin-style noise and cellular automata to carve out biomes,
- * caves, ore veins, and surface decorations (trees).
- * @param chunkX The chunk coordinate (X index) to generate.
+ * @brief Surface row of a column. A resident Complete chunk is scanned for its
+ * first block, so player edits and trees count. Otherwise only the chunk's
+ * heightmap is generated, which costs a few noise samples instead of a full chunk.
  */
-void World::generateChunk(int chunkX) {
-    std::vector<int> newChunk;
-    std::vector<int> newBgChunk;
-
-    int totalBlocks = CHUNK_WIDTH * WORLD_HEIGHT;
-    newChunk.resize(totalBlocks, 0);
-    newBgChunk.resize(totalBlocks, 0);
-
-    float seed = 97.0f; // Static seed for testing, make variable for random worlds
-    int surfaceHeights[CHUNK_WIDTH];
-
-    // ---------------------------------------------------------
-    // STEP 1: BASE TERRAIN & BIOMES (Deserts and Snow)
-    // ---------------------------------------------------------
-    for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
-        int globalX = (chunkX * CHUNK_WIDTH) + localX;
-
-        // 1. CALCULATE SURFACE ELEVATION (Rolling hills)
-        float n1 = std::sin((globalX + seed) / 50.0f);
-        float n2 = std::sin((globalX + seed) / 25.0f) * 0.5f;
-        float baseHeight = 80.0f;
-        int surfaceY = static_cast<int>(baseHeight + ((n1 + n2) * 15.0f));
-        surfaceHeights[localX] = surfaceY;
-
-        // 2. CALCULATE BIOME "MOISTURE" (Temperature zones)
-        float biomeValue = std::sin((globalX - 100) / 500.0f);
-
-        bool isDesert = (biomeValue > 0.5f);
-        bool isSnow = (biomeValue < -0.5f);
-
-        // Calculate specific depth and shape properties for special biomes
-        float biomeDepth = 0.0f;
-
-        if (isDesert) {
-            // Intensity from 0.0 (edge) to 1.0 (center)
-            float intensity = (biomeValue - 0.5f) * 2.0f;
-            // "Bag" shape: Wide and deep, drops sharply (exponent 0.5)
-            biomeDepth = 45.0f * std::pow(intensity, 0.5f);
-        }
-        else if (isSnow) {
-            float intensity = (std::abs(biomeValue) - 0.5f) * 2.0f;
-            // "V" / "Diamond" shape: Drops down in a straight, pointy angle (exponent 1.2)
-            biomeDepth = 45.0f * std::pow(intensity, 1.2f);
-        }
-
-        // Fill the vertical column for this X coordinate
+int World::getSurfaceHeight(int x) {
+    int lx = x & CHUNK_MASK;
+    if (const Chunk* chunk = findCompleteChunk(x >> CHUNK_SHIFT)) {
         for (int y = 0; y < WORLD_HEIGHT; ++y) {
-            int index = y * CHUNK_WIDTH + localX;
-            int blockID = 0;
-            int bgID = 0;
-
-            // Background Walls (Generated based on depth)
-            if (y > surfaceY) {
-                if (y < surfaceY + 10) bgID = ItemID::BG_DIRT; // Dirt wall layer
-                else bgID = ItemID::BG_STONE;                  // Deep Stone wall layer
-            }
-
-            // Foreground Solid Blocks
-            if (y >= WORLD_HEIGHT - 2) {
-                blockID = ItemID::BEDROCK; // Unbreakable Bedrock bottom layer
-            }
-            else if (y >= surfaceY) {
-                int depthFromSurface = y - surfaceY;
-
-                // Apply biome overlays overrides based on the calculated depth curve
-                if (isDesert && depthFromSurface <= biomeDepth) {
-                    blockID = ItemID::SAND; // Sand block filling the desert pocket
-                }
-                else if (isSnow && depthFromSurface <= biomeDepth) {
-                    blockID = ItemID::SNOW; // Snow block filling the tundra pocket
-                }
-                else {
-                    // Standard geology generation
-                    if (depthFromSurface < 5) blockID = ItemID::DIRT;   // Dirt layer
-                    else blockID = ItemID::STONE;                       // Deep Stone layer
-                }
-            }
-
-            newChunk[index] = blockID;
-            newBgChunk[index] = bgID;
-        }
-    }
-
-    // ---------------------------------------------------------
-    // STEP 1.5: CAVE SYSTEMS (Worm tunnels + Isolated pockets)
-    // ---------------------------------------------------------
-    // 1. Carve raw noise
-    for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
-        int globalX = (chunkX * CHUNK_WIDTH) + localX;
-        int surfaceY = surfaceHeights[localX];
-
-        // Start carving 10 blocks beneath the surface to prevent floating islands
-        for (int y = surfaceY + 10; y < WORLD_HEIGHT - 5; ++y) {
-            int index = y * CHUNK_WIDTH + localX;
-
-            // Only carve through stone
-            if (newChunk[index] == ItemID::STONE) {
-                // A) SPAGHETTI CAVES (Interconnected tunnels)
-                // Combine 3 different sine waves for a chaotic but connected pattern
-                float n1 = std::sin((globalX + seed) / 20.0f);
-                float n2 = std::cos((y + seed) / 15.0f);
-                float n3 = std::sin((globalX - y) / 35.0f);
-                float caveNoise = n1 + n2 + n3;
-
-                // Create a tunnel if the wave values cancel out close to zero
-                bool isWormCave = std::abs(caveNoise) < 0.4f;
-
-                // B) POCKET CAVES (Isolated spherical rooms)
-                bool isPocketCave = (rand() % 100 < 40);
-
-                if (isWormCave || isPocketCave) {
-                    newChunk[index] = 0; // Replace stone with air
-                }
-            }
-        }
-    }
-
-    // 2. Cellular Automata Smoothing (Smooths out jagged edges and floating blocks)
-    int smoothingPasses = 4;
-    for (int p = 0; p < smoothingPasses; ++p) {
-        std::vector<int> tempChunk = newChunk; // Read from previous state buffer
-
-        for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
-            int surfaceY = surfaceHeights[localX];
-
-            for (int y = surfaceY + 10; y < WORLD_HEIGHT - 5; ++y) {
-                int index = y * CHUNK_WIDTH + localX;
-
-                // BIOME SHIELD: Do not smooth Sand or Snow
-                if (tempChunk[index] == ItemID::SAND || tempChunk[index] == ItemID::SNOW) {
-                    continue;
-                }
-
-                int neighborWalls = 0;
-
-                // Count solid neighbor blocks within a 3x3 grid
-                for (int nx = localX - 1; nx <= localX + 1; ++nx) {
-                    for (int ny = y - 1; ny <= y + 1; ++ny) {
-                        if (nx >= 0 && nx < CHUNK_WIDTH && ny >= 0 && ny < WORLD_HEIGHT) {
-                            if (nx != localX || ny != y) {
-                                if (tempChunk[ny * CHUNK_WIDTH + nx] != 0) {
-                                    neighborWalls++;
-                                }
-                            }
-                        } else {
-                            // Assume edges outside chunk are solid to prevent infinite bleeding
-                            neighborWalls++;
-                        }
-                    }
-                }
-
-                // Survival rules for smoothing
-                if (neighborWalls > 4) {
-                    newChunk[index] = ItemID::STONE; // Become/Stay solid stone
-                } else if (neighborWalls < 4) {
-                    newChunk[index] = ItemID::AIR; // Become/Stay air
-                }
-            }
+            if (chunk->blocks.get(y * CHUNK_WIDTH + lx) != ItemID::AIR) return y;
         }
+        return WORLD_HEIGHT;
     }
 
-    // ---------------------------------------------------------
-    // STEP 2: ORE VEIN GENERATION
-    // ---------------------------------------------------------
-    // Lambda function to "stamp" a circular vein blob into the chunk
-    auto spawnVein = [&](int count, int id, int minDepth, int maxDepth, int sizeProbability) {
-        for (int i = 0; i < count; ++i) {
-            // Choose a random center coordinate within the chunk depth bounds
-            int cx = rand() % CHUNK_WIDTH;
-            int cy = minDepth + (rand() % (maxDepth - minDepth));
-
-            // Populate a 3x3 area around the center point based on probability
-            for (int vx = -1; vx <= 1; ++vx) {
-                for (int vy = -1; vy <= 1; ++vy) {
-                    if ((rand() % 100) > sizeProbability) continue;
-
-                    int nx = cx + vx;
-                    int ny = cy + vy;
-
-                    if (nx >= 0 && nx < CHUNK_WIDTH && ny >= 0 && ny < WORLD_HEIGHT) {
-                        int index = ny * CHUNK_WIDTH + nx;
-                        // ONLY overwrite Stone (Do not destroy caves or dirt)
-                        if (newChunk[index] == ItemID::STONE) {
-                            newChunk[index] = id;
-                        }
-                    }
-                }
-            }
-        }
-    };
-
-    // --- ORE CONFIGURATION (Attempts, ID, Min Depth, Max Depth, Spread % ) ---
-    spawnVein(6, ItemID::COAL, 20, 150, 80);
-    spawnVein(4, ItemID::COPPER, 30, 150, 70);
-    spawnVein(3, ItemID::IRON, 50, 150, 70);
-    spawnVein(2, ItemID::COBALT, 100, 150, 50);
-    spawnVein(1, ItemID::TUNGSTEN, 130, 150, 40);
-
-    // ---------------------------------------------------------
-    // STEP 3: SURFACE DECORATIONS (Trees)
-    // ---------------------------------------------------------
-    for (int localX = 0; localX < CHUNK_WIDTH; ++localX) {
-        int globalX = (chunkX * CHUNK_WIDTH) + localX;
-        int surfaceY = surfaceHeights[localX];
-
-        int surfaceBlockID = newChunk[surfaceY * CHUNK_WIDTH + localX];
-
-        // Mantenemos la comprobación base pero le damos margen (localX > 4)
-        if (surfaceBlockID == ItemID::DIRT && (std::abs(globalX * 437) % 100) < 10 && localX > 4 && localX < CHUNK_WIDTH - 5) {
-
-            // 1. Altura del tronco (entre 6 y 14 bloques para que sea alto)
-        int trunkHeight = 6 + (rand() % 9);
-        int trunkTopY = surfaceY - trunkHeight;
-
-        // 2. Generar el Tronco Principal (Madera recta)
-        for (int i = 1; i <= trunkHeight; ++i) {
-            int y = surfaceY - i;
-            if (y > 0) newChunk[y * CHUNK_WIDTH + localX] = ItemID::WOOD;
-        }
-
-        // --- Función auxiliar para dibujar "bolas" de hojas limpias ---
-        auto drawLeaves = [&](int cx, int cy, int radius) {
-            for (int lx = -radius; lx <= radius; ++lx) {
-                for (int ly = -radius; ly <= radius; ++ly) {
-                    // Cortar esquinas para hacer la forma de cruz gruesa/círculo
-                    if (std::abs(lx) == radius && std::abs(ly) == radius) continue;
-
-                    int px = cx + lx;
-                    int py = cy + ly;
-
-                    // Límites de seguridad
-                    if (py > 0 && py < WORLD_HEIGHT && px >= 0 && px < CHUNK_WIDTH) {
-                        int idx = py * CHUNK_WIDTH + px;
-                        // Solo colocar hojas si hay aire
-                        if (newChunk[idx] == ItemID::AIR) {
-                            newChunk[idx] = ItemID::LEAVES;
-                        }
-                    }
-                }
-            }
-        };
-
-        // 3. Copa Principal (Posada JUSTO encima del tronco)
-        // Al restar 3, garantizamos que la parte inferior de la copa (que baja 2 bloques)
-        // quede exactamente 1 bloque por encima de trunkTopY.
-        int canopyCenterY = trunkTopY - 3;
-        drawLeaves(localX, canopyCenterY, 2);
-
-        // Le añadimos 3 bloquecitos extra justo arriba para redondear la copa
-        // El borde superior del círculo está a canopyCenterY - 2, así que ponemos esto en - 3.
-        int extraLeavesY = canopyCenterY - 3;
-        if (extraLeavesY > 0) {
-            for (int ox = -1; ox <= 1; ++ox) {
-                int topX = localX + ox;
-                if (topX >= 0 && topX < CHUNK_WIDTH) {
-                    int topIdx = extraLeavesY * CHUNK_WIDTH + topX;
-                    if (newChunk[topIdx] == ItemID::AIR) newChunk[topIdx] = ItemID::LEAVES;
-                }
-            }
-        }
-        }
-    }
-
-    // Save generated arrays into the chunk maps
-    mChunks[chunkX] = newChunk;
-    mBackgroundChunks[chunkX] = newBgChunk;
+    const Chunk& chunk = getChunk(x >> CHUNK_SHIFT, ChunkStage::Heightmap);
+    return chunk.heights[lx];
 }
 
 // ==========================================
@@ -328,12 +168,11 @@ void World::generateChunk(int chunkX) {
 
 /**
  * @brief Renders the visible sections of the world (Culling).
- * Processes dynamic lighting (torches + ambient depth) and draws
- * background walls, foreground blocks, and dropped items.
+ * Draws background walls, foreground blocks, and dropped items unlit;
+ * renderLighting darkens the finished scene afterwards.
  * @param window The render window.
- * @param ambientColor The global daylight/nightlight color.
  */
-void World::render(sf::RenderWindow& window, sf::Color ambientColor) {
+void World::render(sf::RenderWindow& window) {
     sf::View view = window.getView();
 
     // Calculate visible area boundaries
@@ -348,214 +187,367 @@ void World::render(sf::RenderWindow& window, sf::Color ambientColor) {
 
     // STEP 0: ENSURE VISIBLE CHUNKS EXIST
     for (int cx = startChunk; cx <= endChunk; ++cx) {
-        if (mChunks.find(cx) == mChunks.end()) generateChunk(cx);
+        getChunk(cx);
     }
 
-    // STEP 1: SCAN FOR LIGHT SOURCES (Torches)
-    std::vector<sf::Vector2f> lightSources;
+    // STEP 1: DRAW CHUNK MESHES (Background walls + foreground blocks)
+    // Every chunk caches one vertex array per MESH_SECTION_HEIGHT rows, built
+    // against the texture atlas, so a visible section is a single draw call.
+    // Sections are rebuilt only after setBlock touches them.
+    mDrawCalls = 0;
+    const sf::Texture* blockPage = mAtlas.getPage(0);
+    sf::RenderStates atlasStates(blockPage);
+
+    int firstSection = std::max(0, static_cast<int>(std::floor(top / mTileSize)) / MESH_SECTION_HEIGHT);
+    int lastSection = std::min(MESH_SECTION_COUNT - 1, static_cast<int>(std::floor(bottom / mTileSize)) / MESH_SECTION_HEIGHT);
+
     for (int cx = startChunk; cx <= endChunk; ++cx) {
-        auto it = mChunks.find(cx);
-        if (it != mChunks.end()) {
-            const auto& blocks = it->second;
-            for (int y = 0; y < WORLD_HEIGHT; ++y) {
-                float blockY = y * mTileSize;
-                // Minor vertical culling for light checks
-                if (blockY < top - 200 || blockY > bottom + 200) continue;
-
-                for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
-                    if (blocks[y * CHUNK_WIDTH + lx] == ItemID::TORCH) { // ¡Cambiado ID 6 a TORCH!
-                        float wx = (cx * CHUNK_WIDTH + lx) * mTileSize + mTileSize/2.f;
-                        float wy = y * mTileSize + mTileSize/2.f;
-                        lightSources.push_back(sf::Vector2f(wx, wy));
-                    }
-                }
-            }
+        const Chunk* chunk = mChunks.find(cx);
+        if (!chunk) continue;
+
+        auto meshIt = mMeshes.find(cx);
+        if (meshIt == mMeshes.end()) meshIt = mMeshes.emplace(cx, ChunkMesh(MESH_SECTION_COUNT)).first;
+        ChunkMesh& mesh = meshIt->second;
+
+        for (int s = firstSection; s <= lastSection; ++s) {
+            ChunkMesh::Section& section = mesh.getSection(s);
+            if (section.dirty) buildMeshSection(cx, *chunk, s, section);
+            if (section.vertices.getVertexCount() == 0) continue;
+
+            window.draw(section.vertices, atlasStates);
+            mDrawCalls++;
         }
     }
 
-    sf::Sprite sprite;
-    float lightRadius = 250.0f;
-
-    // Dynamic Lighting Calculation Lambda
-    auto calculateLight = [&](sf::Vector2f blockPos, sf::Color baseColor) -> sf::Color {
-        float r = baseColor.r;
-        float g = baseColor.g;
-        float b = baseColor.b;
+    // Drop the meshes of chunks that scrolled out of view (rebuilt if they come back)
+    for (auto it = mMeshes.begin(); it != mMeshes.end();) {
+        if (it->first < startChunk - MESH_KEEP_MARGIN || it->first > endChunk + MESH_KEEP_MARGIN) it = mMeshes.erase(it);
+        else ++it;
+    }
 
-        float torchR = 0.0f, torchG = 0.0f, torchB = 0.0f;
+    // STEP 2: DRAW DROPPED ITEMS
+    // Moving drops plus the sleeping buckets overlapping the view, batched into
+    // one vertex array per atlas page (icons share page 0: one draw call)
+    std::vector<std::pair<const sf::Texture*, sf::VertexArray>> batches;
+    auto appendQuad = [&](const TextureAtlas::Region& region, sf::Vector2f center) {
+        auto batch = std::find_if(batches.begin(), batches.end(), [&](const auto& b) { return b.first == region.texture; });
+        if (batch == batches.end()) batch = batches.insert(batches.end(), { region.texture, sf::VertexArray(sf::Quads) });
+
+        // Scaled down to half size on the ground
+        float halfW = region.rect.width * 0.25f;
+        float halfH = region.rect.height * 0.25f;
+        float texLeft = static_cast<float>(region.rect.left);
+        float texTop = static_cast<float>(region.rect.top);
+        float texRight = texLeft + region.rect.width;
+        float texBottom = texTop + region.rect.height;
+
+        sf::VertexArray& drops = batch->second;
+        drops.append(sf::Vertex(sf::Vector2f(center.x - halfW, center.y - halfH), sf::Vector2f(texLeft, texTop)));
+        drops.append(sf::Vertex(sf::Vector2f(center.x + halfW, center.y - halfH), sf::Vector2f(texRight, texTop)));
+        drops.append(sf::Vertex(sf::Vector2f(center.x + halfW, center.y + halfH), sf::Vector2f(texRight, texBottom)));
+        drops.append(sf::Vertex(sf::Vector2f(center.x - halfW, center.y + halfH), sf::Vector2f(texLeft, texBottom)));
+    };
+    auto drawDrop = [&](const ItemDrop& item) {
+        TextureAtlas::Region region = getItemRegion(item.id);
+        if (!region.texture) return;
 
-        for (const auto& lightPos : lightSources) {
-            float dx = std::abs(blockPos.x - lightPos.x);
-            float dy = std::abs(blockPos.y - lightPos.y);
+        // Stacks show a second icon peeking out behind the first
+        if (item.count > 1) appendQuad(region, item.pos + sf::Vector2f(4.0f, -4.0f));
+        appendQuad(region, item.pos);
+    };
 
-            // Optimization: Skip distance calc if strictly outside AABB bounds
-            if (dx > lightRadius || dy > lightRadius) continue;
+    for (const auto& item : mItems) drawDrop(item);
+
+    int firstBucketX = static_cast<int>(std::floor(left / DROP_BUCKET_SIZE)) - 1;
+    int lastBucketX = static_cast<int>(std::floor(right / DROP_BUCKET_SIZE)) + 1;
+    int firstBucketY = static_cast<int>(std::floor(top / DROP_BUCKET_SIZE)) - 1;
+    int lastBucketY = static_cast<int>(std::floor(bottom / DROP_BUCKET_SIZE)) + 1;
+    for (int by = firstBucketY; by <= lastBucketY; ++by) {
+        for (int bx = firstBucketX; bx <= lastBucketX; ++bx) {
+            auto bucket = mSleepingDrops.find(dropBucketKey(bx, by));
+            if (bucket == mSleepingDrops.end()) continue;
+            for (const auto& item : bucket->second) drawDrop(item);
+        }
+    }
 
-            float dist = std::sqrt(dx*dx + dy*dy);
+    for (const auto& batch : batches) {
+        window.draw(batch.second, sf::RenderStates(batch.first));
+        mDrawCalls++;
+    }
+}
 
-            if (dist < lightRadius) {
-                // Linear intensity falloff
-                float intensity = 1.0f - (dist / lightRadius);
+/**
+ * @brief Multiplies the world's light over everything drawn so far.
+ * One texel per tile is filled from the skylight and torch light arrays, then
+ * the texture is stretched over the view with bilinear filtering (smooth
+ * gradients between tiles) and drawn once with multiplicative blending.
+ * @param window The render window (its current view decides the covered area).
+ * @param skyColor The global daylight/nightlight color.
+ */
+void World::renderLighting(sf::RenderWindow& window, sf::Color skyColor) {
+    sf::View view = window.getView();
+    float left = view.getCenter().x - (view.getSize().x / 2.f);
+    float top = view.getCenter().y - (view.getSize().y / 2.f);
 
-                // Additive torch light (Warm fire colors: Max Red, High Green, Low Blue)
-                torchR = std::max(torchR, intensity * 255.0f);
-                torchG = std::max(torchG, intensity * 200.0f);
-                torchB = std::max(torchB, intensity * 120.0f);
-            }
+    // Visible tiles, plus a ring of margin texels so filtering at the edges
+    // blends with real neighbours instead of stale texture contents
+    int firstX = static_cast<int>(std::floor(left / mTileSize));
+    int firstY = static_cast<int>(std::floor(top / mTileSize));
+    int visibleW = static_cast<int>(std::ceil(view.getSize().x / mTileSize)) + 1;
+    int visibleH = static_cast<int>(std::ceil(view.getSize().y / mTileSize)) + 1;
+    int width = visibleW + 2 * LIGHTMAP_MARGIN;
+    int height = visibleH + 2 * LIGHTMAP_MARGIN;
+
+    mLightPixels.resize(static_cast<size_t>(width) * height * 4);
+    for (int ty = 0; ty < height; ++ty) {
+        int y = firstY - LIGHTMAP_MARGIN + ty;
+        for (int tx = 0; tx < width; ++tx) {
+            int x = firstX - LIGHTMAP_MARGIN + tx;
+
+            // Light sources are the only tiles at MAX_LIGHT: never darken them
+            sf::Color light = (mLight.getLevel(x, y) == LightEngine::MAX_LIGHT)
+                ? sf::Color::White
+                : getLightColor(sf::Vector2f((x + 0.5f) * mTileSize, (y + 0.5f) * mTileSize), skyColor);
+
+            sf::Uint8* texel = &mLightPixels[(static_cast<size_t>(ty) * width + tx) * 4];
+            texel[0] = light.r;
+            texel[1] = light.g;
+            texel[2] = light.b;
+            texel[3] = 255;
         }
+    }
 
-        // Screen blending: Choose the brightest value between ambient daylight and torchlight
-        r = std::max(r, torchR);
-        g = std::max(g, torchG);
-        b = std::max(b, torchB);
+    // The texture only grows; a smaller frame uses its top-left corner
+    sf::Vector2u size = mLightTexture.getSize();
+    if (size.x < static_cast<unsigned>(width) || size.y < static_cast<unsigned>(height)) {
+        mLightTexture.create(std::max(size.x, static_cast<unsigned>(width)), std::max(size.y, static_cast<unsigned>(height)));
+        mLightTexture.setSmooth(true);
+    }
+    mLightTexture.update(mLightPixels.data(), width, height, 0, 0);
+
+    // Texel centers land on tile centers; the margin texels stay off-screen
+    float worldLeft = firstX * mTileSize;
+    float worldTop = firstY * mTileSize;
+    float worldRight = (firstX + visibleW) * mTileSize;
+    float worldBottom = (firstY + visibleH) * mTileSize;
+    float texLeft = static_cast<float>(LIGHTMAP_MARGIN);
+    float texTop = static_cast<float>(LIGHTMAP_MARGIN);
+    float texRight = static_cast<float>(LIGHTMAP_MARGIN + visibleW);
+    float texBottom = static_cast<float>(LIGHTMAP_MARGIN + visibleH);
+
+    sf::VertexArray quad(sf::Quads, 4);
+    quad[0] = sf::Vertex(sf::Vector2f(worldLeft, worldTop), sf::Vector2f(texLeft, texTop));
+    quad[1] = sf::Vertex(sf::Vector2f(worldRight, worldTop), sf::Vector2f(texRight, texTop));
+    quad[2] = sf::Vertex(sf::Vector2f(worldRight, worldBottom), sf::Vector2f(texRight, texBottom));
+    quad[3] = sf::Vertex(sf::Vector2f(worldLeft, worldBottom), sf::Vector2f(texLeft, texBottom));
+
+    sf::RenderStates states(sf::BlendMultiply);
+    states.texture = &mLightTexture;
+    window.draw(quad, states);
+    mDrawCalls++;
+}
 
-        // Clamp to prevent visual overflow
-        return sf::Color(static_cast<sf::Uint8>(std::min(r, 255.0f)),
-                         static_cast<sf::Uint8>(std::min(g, 255.0f)),
-                         static_cast<sf::Uint8>(std::min(b, 255.0f)));
-    };
+// ==========================================
+// WORLD INTERACTION (Mining & Placing)
+// ==========================================
 
-    // STEP 2: DRAW BACKGROUND WALLS
-    for (int cx = startChunk; cx <= endChunk; ++cx) {
-        auto itBg = mBackgroundChunks.find(cx);
-        if (itBg == mBackgroundChunks.end() || itBg->second.empty()) continue;
+/**
+ * @brief Overwrites a block at the specified global coordinates.
+ * Called when the player mines or places a block.
+ */
+void World::setBlock(int x, int y, int type) {
+    if (y < 0 || y >= WORLD_HEIGHT) return;
 
-        const auto& bgBlocks = itBg->second;
+    Chunk& chunk = getChunk(x >> CHUNK_SHIFT);
+    chunk.blocks.set(y * CHUNK_WIDTH + (x & CHUNK_MASK), type);
+    chunk.dirty = true;
 
-        for (int y = 0; y < WORLD_HEIGHT; ++y) {
-            float py = y * mTileSize;
-            if (py < top || py > bottom) continue; // Vertical culling
+    uint16_t bit = static_cast<uint16_t>(1u << (x & CHUNK_MASK));
+    if (isSolid(type)) chunk.solid[y] |= bit;
+    else chunk.solid[y] &= static_cast<uint16_t>(~bit);
+    invalidateMesh(x, y);
 
-            for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
-                int blockID = bgBlocks[y * CHUNK_WIDTH + lx];
-                if (blockID != 0 && mTextures.count(blockID)) {
-                    sprite.setTexture(mTextures[blockID]);
+    // Only the tile and the 4 neighbours that read it can change mask
+    // (updateMask flags their mesh sections when they do)
+    updateMask(x, y);
+    updateMask(x + 1, y);
+    updateMask(x - 1, y);
+    updateMask(x, y + 1);
+    updateMask(x, y - 1);
 
-                    float px = (cx * CHUNK_WIDTH + lx) * mTileSize;
-                    sprite.setPosition(px, py);
+    mLight.onBlockChanged(x, y);
+    updateSkyTop(x, y);
 
-                    float scale = mTileSize / sprite.getLocalBounds().width;
-                    sprite.setScale(scale, scale);
+    // Drops resting on (or inside) the tile must react to the new ground
+    wakeDrops(sf::Vector2f((x + 0.5f) * mTileSize, (y + 0.5f) * mTileSize), mTileSize * 1.5f);
+}
 
-                    sf::Vector2f center(px + mTileSize/2, py + mTileSize/2);
-                    sf::Color lightColor = calculateLight(center, ambientColor);
+// ==========================================
+// CHUNK RESIDENCY (LRU + Disk Cache)
+// ==========================================
 
-                    // Depth trick: Darken background walls by 50% so they visually sit "behind"
-                    lightColor.r = static_cast<sf::Uint8>(lightColor.r * 0.5f);
-                    lightColor.g = static_cast<sf::Uint8>(lightColor.g * 0.5f);
-                    lightColor.b = static_cast<sf::Uint8>(lightColor.b * 0.5f);
+/**
+ * @brief Resolves a chunk miss: spilled chunks are read back from the cache,
+ * anything else is generated (or advanced) up to the requested stage.
+ */
+Chunk& World::loadOrGenerateChunk(int chunkX, ChunkStage stage) {
+    // Partially generated chunks only run the stages they are missing
+    Chunk* partial = mChunks.find(chunkX);
+    if (partial) {
+        mGenerator.getTerrain().advance(*partial, chunkX, stage);
+        if (stage == ChunkStage::Complete) {
+            mSyncGenerated++;
+            onChunkCompleted(chunkX, *partial);
+        }
+        return *partial;
+    }
 
-                    sprite.setColor(lightColor);
-                    window.draw(sprite);
-                }
-            }
+    if (mSpilledChunks.count(chunkX)) {
+        auto chunk = std::make_unique<Chunk>();
+        if (readSpilledChunk(chunkX, *chunk)) {
+            chunk->dirty = false; // Identical to its cached copy until modified
+            Chunk& loaded = mChunks.insert(chunkX, std::move(chunk));
+            onChunkCompleted(chunkX, loaded);
+            return loaded;
         }
+        std::cerr << "Error: Could not read cached chunk " << chunkX << ", regenerating." << std::endl;
+        mSpilledChunks.erase(chunkX);
     }
 
-    // STEP 3: DRAW FOREGROUND BLOCKS
-    for (int cx = startChunk; cx <= endChunk; ++cx) {
-        auto it = mChunks.find(cx);
-        if (it == mChunks.end()) continue;
+    // Generation is a pure function of (seed, chunkX), so an unmodified chunk is
+    // clean: eviction simply drops it and the next access regenerates it.
+    auto chunk = std::make_unique<Chunk>();
+    mGenerator.getTerrain().advance(*chunk, chunkX, stage);
+    if (stage == ChunkStage::Complete) mSyncGenerated++;
+    else mPartialGenerated++;
 
-        const auto& blocks = it->second;
+    Chunk& generated = mChunks.insert(chunkX, std::move(chunk));
+    if (stage == ChunkStage::Complete) onChunkCompleted(chunkX, generated);
+    return generated;
+}
 
-        for (int y = 0; y < WORLD_HEIGHT; ++y) {
-             float py = y * mTileSize;
-             if (py < top || py > bottom) continue;
-
-            for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
-                int blockID = blocks[y * CHUNK_WIDTH + lx];
-
-                if (blockID != 0) {
-                    float px = (cx * CHUNK_WIDTH + lx) * mTileSize;
-                    sf::Vector2f center(px + mTileSize/2, py + mTileSize/2);
-
-                    // ==========================================
-                    // --- DIBUJADO DE AUTOTILING (TIERRA, PIEDRA, ETC) ---
-                    // ==========================================
-                    if (mAutotileTextures.count(blockID)) {
-                        sf::Sprite autoSprite(mAutotileTextures[blockID]);
-
-                        // Calculamos la X global real en el mundo
-                        int globalX = cx * CHUNK_WIDTH + lx;
-
-                        // Pasamos el propio blockID como target
-                        int mask = getBitmask(globalX, y, blockID);
-
-                        // Calculamos Fila y Columna
-                        int col = mask % 4;
-                        int row = mask / 4;
-
-                        // Recortamos la textura y posicionamos
-                        autoSprite.setTextureRect(sf::IntRect(col * mTileSize, row * mTileSize, mTileSize, mTileSize));
-                        autoSprite.setPosition(px, py);
-
-                        // Iluminación dinámica
-                        autoSprite.setColor(calculateLight(center, ambientColor));
-
-                        window.draw(autoSprite);
-                    }
-                    // ==========================================
-                    // --- DIBUJADO NORMAL (MADERA, MINERALES, ETC) ---
-                    // ==========================================
-                    else if (mTextures.count(blockID)) {
-                        sprite.setTexture(mTextures[blockID]);
-                        sprite.setPosition(px, py);
-
-                        float scale = mTileSize / sprite.getLocalBounds().width;
-                        sprite.setScale(scale, scale);
-
-                        if (blockID == ItemID::TORCH) { // Torches always render at max brightness
-                            sprite.setColor(sf::Color::White);
-                        } else {
-                            sprite.setColor(calculateLight(center, ambientColor));
-                        }
-
-                        window.draw(sprite);
-                    }
-                }
-            }
-        }
+void World::onChunkCompleted(int chunkX, Chunk& chunk) {
+    buildSolidRows(chunk);
+    buildMasks(chunkX, chunk);
+    buildSkyTops(chunk);
+    mLight.lightChunk(chunkX, chunk);
+}
+
+/**
+ * @brief Publishes worker results, then re-queues the chunks around the focus
+ * point and along its direction of travel.
+ */
+void World::streamChunks(sf::Vector2f focus, sf::Vector2f velocity) {
+    // 1. Publish finished chunks. A chunk may already be resident (synchronous
+    //    fallback) or cached on disk (modified and evicted); those versions win.
+    //    Partially generated chunks are never modified, so they are replaced.
+    for (auto& result : mGenerator.takeCompleted()) {
+        const Chunk* resident = mChunks.find(result.first);
+        if ((resident && resident->stage == ChunkStage::Complete) || mSpilledChunks.count(result.first)) continue;
+
+        Chunk& chunk = mChunks.insert(result.first, std::move(result.second));
+        chunk.lastUsed = mFrameCounter; // Fresh: not an eviction candidate yet
+        onChunkCompleted(result.first, chunk);
+        mAsyncGenerated++;
     }
 
-    // STEP 4: DRAW DROPPED ITEMS
-    for (const auto& item : mItems) {
-        const sf::Texture* tex = getTexture(item.id);
-        if (tex) {
-            sf::Sprite itemSprite(*tex);
-            itemSprite.setPosition(item.pos);
+    // 2. Queue the missing chunks between the focus point and where it will be
+    //    after PREFETCH_LOOKAHEAD seconds of travel.
+    float chunkPixels = CHUNK_WIDTH * mTileSize;
+    float focusChunk = focus.x / chunkPixels;
+    float aheadChunk = (focus.x + velocity.x * PREFETCH_LOOKAHEAD) / chunkPixels;
 
-            // Center origin for correct placement and potential rotation
-            itemSprite.setOrigin(tex->getSize().x / 2.0f, tex->getSize().y / 2.0f);
+    int firstChunk = static_cast<int>(std::floor(std::min(focusChunk, aheadChunk))) - PREFETCH_RADIUS;
+    int lastChunk = static_cast<int>(std::floor(std::max(focusChunk, aheadChunk))) + PREFETCH_RADIUS;
 
-            // Scale down standard blocks on the ground
-            itemSprite.setScale(0.5f, 0.5f);
+    std::vector<std::pair<float, int>> requests;
+    for (int cx = firstChunk; cx <= lastChunk; ++cx) {
+        const Chunk* resident = mChunks.find(cx);
+        if ((resident && resident->stage == ChunkStage::Complete) || mSpilledChunks.count(cx)) continue;
 
-            itemSprite.setColor(calculateLight(item.pos, ambientColor));
-            window.draw(itemSprite);
-        }
+        // Nearest first; chunks in the direction of travel count as half as far
+        float offset = (cx + 0.5f) - focusChunk;
+        bool isAhead = offset * velocity.x > 0.0f;
+        requests.push_back({ std::abs(offset) * (isAhead ? 0.5f : 1.0f), cx });
     }
+    mGenerator.schedule(requests);
 }
 
-// ==========================================
-// WORLD INTERACTION (Mining & Placing)
-// ==========================================
-
 /**
- * @brief Overwrites a block at the specified global coordinates.
- * Called when the player mines or places a block.
+ * @brief Once per frame: advances the LRU clock and, while over budget, evicts
+ * the least recently used chunks outside the keep radius.
  */
-void World::setBlock(int x, int y, int type) {
-    if (y < 0 || y >= WORLD_HEIGHT) return;
+void World::updateResidency(sf::Time dt, int focusChunk) {
+    mFrameCounter++;
+
+    // Eviction rate over a one second window
+    mEvictionWindowTimer += dt.asSeconds();
+    if (mEvictionWindowTimer >= 1.0f) {
+        mEvictionRate = mEvictionsThisWindow / mEvictionWindowTimer;
+        mEvictionsThisWindow = 0;
+        mEvictionWindowTimer = 0.0f;
+    }
+
+    if (mChunks.size() <= mResidentBudget) return;
+
+    // Candidates: (last use, chunk index). Chunks near the player or used
+    // during the previous frame (visible on screen) are never evicted.
+    std::vector<std::pair<uint64_t, int>> candidates;
+    mChunks.forEach([&](int chunkX, const Chunk& chunk) {
+        if (std::abs(chunkX - focusChunk) <= CHUNK_KEEP_RADIUS) return;
+        if (chunk.lastUsed + 1 >= mFrameCounter) return;
+        candidates.push_back({ chunk.lastUsed, chunkX });
+    });
+
+    size_t excess = std::min(mChunks.size() - mResidentBudget, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + excess, candidates.end());
+
+    for (size_t i = 0; i < excess; ++i) {
+        int chunkX = candidates[i].second;
+        Chunk* chunk = mChunks.find(chunkX);
+        if (chunk && !evictChunk(chunkX, *chunk)) break; // Disk trouble: retry next frame
+    }
+}
 
-    int chunkIndex = static_cast<int>(std::floor(x / (float)CHUNK_WIDTH));
-    int localX = (x % CHUNK_WIDTH + CHUNK_WIDTH) % CHUNK_WIDTH;
+bool World::evictChunk(int chunkX, Chunk& chunk) {
+    if (chunk.dirty) {
+        if (!spillChunk(chunkX, chunk)) return false;
+    }
+
+    mChunks.erase(chunkX);
+    mMeshes.erase(chunkX);
+    mEvictionCount++;
+    mEvictionsThisWindow++;
+    return true;
+}
 
-    if (mChunks.find(chunkIndex) == mChunks.end()) {
-        generateChunk(chunkIndex);
+bool World::spillChunk(int chunkX, const Chunk& chunk) {
+    std::ofstream file(spillPath(chunkX), std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not write chunk cache file for chunk " << chunkX << "." << std::endl;
+        return false;
     }
 
-    mChunks[chunkIndex][y * CHUNK_WIDTH + localX] = type;
+    writeChunkData(file, chunk);
+    if (!file) return false;
+
+    mSpilledChunks.insert(chunkX);
+    return true;
+}
+
+bool World::readSpilledChunk(int chunkX, Chunk& chunk) const {
+    std::ifstream file(spillPath(chunkX), std::ios::binary);
+    return file.is_open() && readChunkData(file, chunk, mGenerator.getTerrain(), chunkX);
+}
+
+void World::clearChunkCache() {
+    std::error_code ec;
+    std::filesystem::remove_all(CHUNK_CACHE_DIR, ec);
+    std::filesystem::create_directories(CHUNK_CACHE_DIR, ec);
+    if (ec) {
+        std::cerr << "Error: Could not create chunk cache directory '" << CHUNK_CACHE_DIR << "'." << std::endl;
+    }
+    mSpilledChunks.clear();
 }
 
 // ==========================================
@@ -565,9 +557,10 @@ void World::setBlock(int x, int y, int type) {
 /**
  * @brief Spawns an item exactly at the center of a grid tile (used for mining).
  */
-void World::spawnItem(int x, int y, int id) {
+void World::spawnItem(int x, int y, int id, int count) {
     ItemDrop item;
     item.id = id;
+    item.count = count;
 
     // Centered position
     item.pos = sf::Vector2f(x * mTileSize + mTileSize/2, y * mTileSize + mTileSize/2);
@@ -585,9 +578,10 @@ void World::spawnItem(int x, int y, int id) {
 /**
  * @brief Spawns an item at an absolute world position (used for dead mobs).
  */
-void World::spawnItem(int id, sf::Vector2f pos) {
+void World::spawnItem(int id, sf::Vector2f pos, int count) {
     ItemDrop item;
     item.id = id;
+    item.count = count;
     item.pos = pos;
     item.vel = sf::Vector2f((rand() % 100 - 50), -150.0f);
     item.timeAlive = 0.0f;
@@ -597,62 +591,132 @@ void World::spawnItem(int id, sf::Vector2f pos) {
 
 /**
  * @brief Updates physics (gravity) and magnetic attraction for dropped items.
+ * Only drops in motion are simulated; resting drops sleep until the player
+ * comes within magnet range or the ground under them changes.
  * @param dt Time elapsed.
  * @param playerPos Player's center coordinates for distance checks.
  * @param inventory A map passed by reference to add picked-up items to.
  */
 void World::update(sf::Time dt, sf::Vector2f playerPos, std::map<int, int>& inventory) {
-    // Iterate manually to safely delete items that are picked up
-    for (auto it = mItems.begin(); it != mItems.end(); ) {
-        ItemDrop& item = *it;
-        item.timeAlive += dt.asSeconds();
+    updateResidency(dt, static_cast<int>(std::floor(playerPos.x / mTileSize)) >> CHUNK_SHIFT);
+
+    float dtSec = dt.asSeconds();
+
+    // Sleeping drops only need a magnet check from the buckets around the player
+    wakeDrops(playerPos, MAGNET_RANGE);
+
+    // Swap-remove drops that are picked up or fall asleep
+    for (size_t i = 0; i < mItems.size(); ) {
+        ItemDrop& item = mItems[i];
+        item.timeAlive += dtSec;
 
         float dx = playerPos.x - item.pos.x;
         float dy = playerPos.y - item.pos.y;
-        float dist = std::sqrt(dx*dx + dy*dy);
-
-        float magnetRange = 125.0f;
-        float pickupRange = 30.0f;
-        float magnetForce = 40.0f;
+        float distSq = dx*dx + dy*dy;
+        bool inMagnetRange = distSq < MAGNET_RANGE * MAGNET_RANGE;
 
         // 1. Magnetic Attraction towards player
-        if (dist < magnetRange && item.timeAlive > 0.5f) { // 0.5s delay before magnetism activates
-            float dirX = dx / dist;
-            float dirY = dy / dist;
-            item.vel.x += dirX * magnetForce;
-            item.vel.y += dirY * magnetForce;
+        if (inMagnetRange && item.timeAlive > DROP_SLEEP_DELAY) { // Delay before magnetism activates
+            float dist = std::sqrt(distSq);
+            if (dist > 0.0f) {
+                item.vel.x += dx / dist * MAGNET_FORCE;
+                item.vel.y += dy / dist * MAGNET_FORCE;
+            }
             item.vel *= 0.95f; // Dampen velocity to prevent orbiting
         }
         else {
             // 2. Normal Gravity Fall
-            item.vel.y += 800.0f * dt.asSeconds();
+            item.vel.y += 800.0f * dtSec;
             item.vel.x *= 0.95f; // Horizontal air friction
         }
 
-        item.pos += item.vel * dt.asSeconds();
+        item.pos += item.vel * dtSec;
 
         // 3. Ground Collision (Only if not being magnetized)
-        if (dist >= magnetRange) {
-            int gridX = static_cast<int>(item.pos.x / mTileSize);
-            int gridY = static_cast<int>(item.pos.y / mTileSize);
+        bool grounded = false;
+        if (!inMagnetRange) {
+            int gridX = static_cast<int>(std::floor(item.pos.x / mTileSize));
+            int gridY = static_cast<int>(std::floor(item.pos.y / mTileSize));
 
             // If inside a solid block, snap to grid top and stop falling
             if (getBlock(gridX, gridY) != 0) {
                 item.pos.y = gridY * mTileSize;
                 item.vel.y = 0;
                 item.vel.x *= 0.5f; // Hard friction against ground
+                grounded = true;
             }
         }
 
         // 4. Pickup Event
-        if (dist < pickupRange && item.timeAlive > 0.2f) {
-            inventory[item.id]++; // Add to temporary pickup map
-            std::cout << "Picked up! ID: " << item.id << std::endl;
+        if (distSq < PICKUP_RANGE * PICKUP_RANGE && item.timeAlive > 0.2f) {
+            inventory[item.id] += item.count; // Add to temporary pickup map
+            std::cout << "Picked up! ID: " << item.id << " x" << item.count << std::endl;
+        }
+        // 5. At rest: stop simulating it
+        else if (grounded && item.timeAlive > DROP_SLEEP_DELAY && std::abs(item.vel.x) < DROP_SLEEP_SPEED) {
+            sleepDrop(item);
+        }
+        else {
+            ++i;
+            continue;
+        }
 
-            // Erase from world and keep iterator valid
-            it = mItems.erase(it);
-        } else {
-            ++it;
+        mItems[i] = mItems.back();
+        mItems.pop_back();
+    }
+}
+
+void World::sleepDrop(const ItemDrop& item) {
+    int bucketX = static_cast<int>(std::floor(item.pos.x / DROP_BUCKET_SIZE));
+    int bucketY = static_cast<int>(std::floor(item.pos.y / DROP_BUCKET_SIZE));
+
+    // Merge into an identical resting drop nearby (the merge radius is smaller
+    // than a bucket, so the 3x3 buckets around this one cover it)
+    for (int by = bucketY - 1; by <= bucketY + 1; ++by) {
+        for (int bx = bucketX - 1; bx <= bucketX + 1; ++bx) {
+            auto bucket = mSleepingDrops.find(dropBucketKey(bx, by));
+            if (bucket == mSleepingDrops.end()) continue;
+
+            for (ItemDrop& other : bucket->second) {
+                float dx = other.pos.x - item.pos.x;
+                float dy = other.pos.y - item.pos.y;
+                if (other.id == item.id && dx*dx + dy*dy < DROP_MERGE_RADIUS * DROP_MERGE_RADIUS) {
+                    other.count += item.count;
+                    return;
+                }
+            }
+        }
+    }
+
+    ItemDrop resting = item;
+    resting.vel = sf::Vector2f(0.0f, 0.0f);
+    mSleepingDrops[dropBucketKey(bucketX, bucketY)].push_back(resting);
+}
+
+void World::wakeDrops(sf::Vector2f center, float radius) {
+    int firstBucketX = static_cast<int>(std::floor((center.x - radius) / DROP_BUCKET_SIZE));
+    int lastBucketX = static_cast<int>(std::floor((center.x + radius) / DROP_BUCKET_SIZE));
+    int firstBucketY = static_cast<int>(std::floor((center.y - radius) / DROP_BUCKET_SIZE));
+    int lastBucketY = static_cast<int>(std::floor((center.y + radius) / DROP_BUCKET_SIZE));
+
+    for (int by = firstBucketY; by <= lastBucketY; ++by) {
+        for (int bx = firstBucketX; bx <= lastBucketX; ++bx) {
+            auto bucket = mSleepingDrops.find(dropBucketKey(bx, by));
+            if (bucket == mSleepingDrops.end()) continue;
+
+            std::vector<ItemDrop>& drops = bucket->second;
+            for (size_t i = 0; i < drops.size(); ) {
+                float dx = drops[i].pos.x - center.x;
+                float dy = drops[i].pos.y - center.y;
+                if (dx*dx + dy*dy < radius * radius) {
+                    mItems.push_back(drops[i]);
+                    drops[i] = drops.back();
+                    drops.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+            if (drops.empty()) mSleepingDrops.erase(bucket);
         }
     }
 }
@@ -661,62 +725,50 @@ void World::update(sf::Time dt, sf::Vector2f playerPos, std::map<int, int>& inve
 // ASSET MANAGEMENT
 // ==========================================
 
-const sf::Texture* World::getTexture(int id) const {
-    auto it = mTextures.find(id);
-    if (it != mTextures.end()) return &it->second;
-    return nullptr;
+TextureAtlas::Region World::getItemRegion(int id) const {
+    return mAtlas.getRegion(id);
 }
 
-const sf::Texture* World::getHeldTexture(int id) const {
-    auto it = mHeldTextures.find(id);
-    if (it != mHeldTextures.end()) return &it->second;
-    return nullptr;
+TextureAtlas::Region World::getHeldRegion(int id) const {
+    return mAtlas.getRegion(HELD_ATLAS_KEY + id);
 }
 
-const sf::Texture* World::getArmorAnimTexture(int id) const {
-    auto it = mArmorAnimTextures.find(id);
-    if (it != mArmorAnimTextures.end()) return &it->second;
-    return nullptr;
+TextureAtlas::Region World::getArmorAnimRegion(int id) const {
+    return mAtlas.getRegion(ARMOR_ATLAS_KEY + id);
 }
 
 /**
- * @brief Bulk loads all textures from disk into memory.
+ * @brief Bulk loads all images from disk and packs them into the texture atlas.
  */
 void World::loadTextures() {
     auto load = [&](int id, const std::string& filename) {
-        sf::Texture tex;
-        if (!tex.loadFromFile(filename)) {
+        sf::Image img;
+        if (!img.loadFromFile(filename)) {
             std::cerr << "Error loading: " << filename << std::endl;
-            sf::Image img;
             img.create(32, 32, sf::Color::Magenta);
-            tex.loadFromImage(img);
         }
-        mTextures[id] = tex;
+        mAtlas.add(id, img);
     };
 
     auto loadHeld = [&](int id, const std::string& filename) {
-        sf::Texture tex;
-        if (tex.loadFromFile(filename)) mHeldTextures[id] = tex;
+        sf::Image img;
+        if (img.loadFromFile(filename)) mAtlas.add(HELD_ATLAS_KEY + id, img);
         else std::cerr << "Error loading held sprite: " << filename << std::endl;
     };
 
     auto loadArmorAnim = [&](int id, const std::string& filename) {
-        sf::Texture tex;
-        if (tex.loadFromFile(filename)) mArmorAnimTextures[id] = tex;
+        sf::Image img;
+        if (img.loadFromFile(filename)) mAtlas.add(ARMOR_ATLAS_KEY + id, img);
         else std::cerr << "Error loading armor anim: " << filename << std::endl;
     };
 
-    // --- Load Held Tools ---
-    loadHeld(ItemID::WOOD_PICKAXE, "assets/Pickaxewood_hands.png");
-    loadHeld(ItemID::STONE_PICKAXE, "assets/Pickaxestone_hands.png");
-    loadHeld(ItemID::IRON_PICKAXE, "assets/Pickaxeiron_hands.png");
-    loadHeld(ItemID::TUNGSTEN_PICKAXE, "assets/Pickaxetungsten_hands.png");
-
-    loadHeld(ItemID::WOOD_SWORD, "assets/Swordwood_hands.png");
-    loadHeld(ItemID::STONE_SWORD, "assets/Swordstone_hands.png");
-    loadHeld(ItemID::IRON_SWORD, "assets/Swordiron_hands.png");
-    loadHeld(ItemID::TUNGSTEN_SWORD, "assets/Swordtungsten_hands.png");
-    loadHeld(ItemID::BOW, "assets/Bow_hands.png");
+    // Each autotile frame is packed separately so every frame gets its own bleed border
+    auto loadAutotile = [&](int id, const std::string& filename) {
+        sf::Image img;
+        int frame = static_cast<int>(mTileSize);
+        if (img.loadFromFile(filename)) mAtlas.addSheet(AUTOTILE_ATLAS_KEY + id * AUTOTILE_FRAMES, img, frame, frame);
+        else std::cerr << "Error: Missing autotile sheet: " << filename << std::endl;
+    };
 
     // --- Load Blocks & Items ---
     load(ItemID::DIRT, "assets/Dirt.png");
@@ -732,6 +784,10 @@ void World::loadTextures() {
     load(ItemID::BG_DIRT, "assets/Dirt.png");
     load(ItemID::BG_STONE, "assets/Stone.png");
 
+    // --- Autotile Sheets ---
+    loadAutotile(ItemID::DIRT, "assets/dirt_autotile.png");
+    loadAutotile(ItemID::LEAVES, "assets/leaves_autotile.png");
+
     // Ores
     load(ItemID::COAL, "assets/Coal.png");
     load(ItemID::COPPER, "assets/Copper.png");
@@ -779,19 +835,91 @@ void World::loadTextures() {
     load(ItemID::WOOD_LEGS, "assets/WoodLegs.png");
     load(ItemID::WOOD_BOOTS, "assets/WoodBoots.png");
 
+    // --- Load Held Tools ---
+    loadHeld(ItemID::WOOD_PICKAXE, "assets/Pickaxewood_hands.png");
+    loadHeld(ItemID::STONE_PICKAXE, "assets/Pickaxestone_hands.png");
+    loadHeld(ItemID::IRON_PICKAXE, "assets/Pickaxeiron_hands.png");
+    loadHeld(ItemID::TUNGSTEN_PICKAXE, "assets/Pickaxetungsten_hands.png");
+
+    loadHeld(ItemID::WOOD_SWORD, "assets/Swordwood_hands.png");
+    loadHeld(ItemID::STONE_SWORD, "assets/Swordstone_hands.png");
+    loadHeld(ItemID::IRON_SWORD, "assets/Swordiron_hands.png");
+    loadHeld(ItemID::TUNGSTEN_SWORD, "assets/Swordtungsten_hands.png");
+    loadHeld(ItemID::BOW, "assets/Bow_hands.png");
+
     // --- Load Animated Armor ---
     loadArmorAnim(ItemID::WOOD_HELMET, "assets/WoodHelmet_Anim.png");
     loadArmorAnim(ItemID::WOOD_CHEST, "assets/WoodChest_Anim.png");
     loadArmorAnim(ItemID::WOOD_LEGS, "assets/WoodLegs_Anim.png");
     loadArmorAnim(ItemID::WOOD_BOOTS, "assets/WoodBoots_Anim.png");
 
-    if (!mAutotileTextures[ItemID::DIRT].loadFromFile("assets/dirt_autotile.png")) {
-        std::cerr << "Error: Faltan las texturas de autotiling de la Tierra" << std::endl;
+    // Pack everything loaded above into the shared atlas
+    if (!mAtlas.build()) {
+        std::cerr << "Error: Some images did not fit in the texture atlas" << std::endl;
+    }
+}
+
+// ==========================================
+// CHUNK MESHES
+// ==========================================
+
+/**
+ * @brief Emits one quad per wall, then one per block, for the rows of a section.
+ * Autotiled blocks pick their frame from the chunk's cached neighbour masks.
+ */
+void World::buildMeshSection(int chunkX, const Chunk& chunk, int section, ChunkMesh::Section& out) {
+    out.vertices.clear();
+
+    int firstY = section * MESH_SECTION_HEIGHT;
+    int lastY = std::min(WORLD_HEIGHT, firstY + MESH_SECTION_HEIGHT);
+    int firstX = chunkX * CHUNK_WIDTH;
+
+    // Meshes are drawn with a single texture: the atlas page the blocks were packed on
+    const sf::Texture* blockPage = mAtlas.getPage(0);
+
+    // Background walls
+    for (int y = firstY; y < lastY; ++y) {
+        for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+            int wallID = chunk.walls.get(y * CHUNK_WIDTH + lx);
+            if (wallID == 0) continue;
+
+            TextureAtlas::Region region = mAtlas.getRegion(wallID);
+            if (region.texture != blockPage) continue; // Missing (or not on the mesh page)
+
+            sf::FloatRect bounds((firstX + lx) * mTileSize, y * mTileSize, mTileSize, mTileSize);
+            ChunkMesh::addQuad(out, bounds, region.rect, ChunkMesh::Shade::Wall);
+        }
     }
 
-    if (!mAutotileTextures[ItemID::LEAVES].loadFromFile("assets/leaves_autotile.png")) {
-        std::cerr << "Error: Faltan las texturas de autotiling de las Hojas" << std::endl;
+    // Foreground blocks
+    for (int y = firstY; y < lastY; ++y) {
+        for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+            int blockID = chunk.blocks.get(y * CHUNK_WIDTH + lx);
+            if (blockID == 0) continue;
+
+            sf::FloatRect bounds((firstX + lx) * mTileSize, y * mTileSize, mTileSize, mTileSize);
+
+            int autotileKey = AUTOTILE_ATLAS_KEY + blockID * AUTOTILE_FRAMES;
+            if (mAtlas.contains(autotileKey)) {
+                // One frame per neighbour mask (cached by buildMasks / updateMask)
+                TextureAtlas::Region region = mAtlas.getRegion(autotileKey + chunk.masks[y * CHUNK_WIDTH + lx]);
+                if (region.texture == blockPage) ChunkMesh::addQuad(out, bounds, region.rect, ChunkMesh::Shade::Block);
+            }
+            else {
+                TextureAtlas::Region region = mAtlas.getRegion(blockID);
+                if (region.texture != blockPage) continue;
+
+                ChunkMesh::addQuad(out, bounds, region.rect, ChunkMesh::Shade::Block);
+            }
+        }
     }
+
+    out.dirty = false;
+}
+
+void World::invalidateMesh(int x, int y) {
+    auto it = mMeshes.find(x >> CHUNK_SHIFT);
+    if (it != mMeshes.end()) it->second.markDirty(y / MESH_SECTION_HEIGHT);
 }
 
 // ==========================================
@@ -800,93 +928,375 @@ void World::loadTextures() {
 
 /**
  * @brief Serializes the map structure to a binary file stream.
+ * Includes the chunks that currently live only in the disk cache.
  */
 void World::saveToStream(std::ofstream& file) {
-    size_t count = mChunks.size();
-    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    uint32_t magic = SAVE_MAGIC;
+    uint32_t version = SAVE_VERSION;
+    file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+
+    uint64_t seed = getSeed();
+    file.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
 
-    for (const auto& pair : mChunks) {
-        int chunkX = pair.first;
-        const std::vector<int>& blocks = pair.second;
-        const std::vector<int>& walls = mBackgroundChunks[chunkX];
+    std::vector<int> spilledOnly;
+    for (int chunkX : mSpilledChunks) {
+        if (!mChunks.find(chunkX)) spilledOnly.push_back(chunkX);
+    }
+
+    // Partially generated chunks are unmodified by definition: leave them out
+    // and let the loader regenerate them from the seed
+    size_t completeCount = 0;
+    mChunks.forEach([&](int, const Chunk& chunk) {
+        if (chunk.stage == ChunkStage::Complete) completeCount++;
+    });
+
+    // Unreadable cached chunks are left out, so the count is patched once the
+    // records are written
+    size_t count = completeCount;
+    std::streampos countPos = file.tellp();
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
 
+    // Records store plain int arrays, independent of the in-memory palette encoding
+    mChunks.forEach([&](int chunkX, const Chunk& chunk) {
+        if (chunk.stage != ChunkStage::Complete) return;
         file.write(reinterpret_cast<const char*>(&chunkX), sizeof(chunkX));
-        file.write(reinterpret_cast<const char*>(blocks.data()), blocks.size() * sizeof(int));
-        file.write(reinterpret_cast<const char*>(walls.data()), walls.size() * sizeof(int));
+        writeChunkData(file, chunk);
+    });
+
+    for (int chunkX : spilledOnly) {
+        Chunk chunk;
+        if (!readSpilledChunk(chunkX, chunk)) {
+            // No record at all: the loader then regenerates the chunk from the seed
+            // (its edits are lost, but it does not become a void)
+            std::cerr << "Error: Could not read cached chunk " << chunkX << " while saving; it will be regenerated." << std::endl;
+            continue;
+        }
+        file.write(reinterpret_cast<const char*>(&chunkX), sizeof(chunkX));
+        writeChunkData(file, chunk);
+        count++;
     }
+
+    std::streampos end = file.tellp();
+    file.seekp(countPos);
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.seekp(end);
 }
 
 /**
  * @brief Deserializes the map structure from a binary file stream.
+ * Chunks beyond the resident budget go straight to the disk cache.
  */
-void World::loadFromStream(std::ifstream& file) {
-    mChunks.clear();
-    mBackgroundChunks.clear();
-    mItems.clear(); // Clear dropped items to prevent load-duplication
+bool World::loadFromStream(std::ifstream& file) {
+    // Validate the header before touching the current world
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t seed = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&seed), sizeof(seed));
+    if (!file || magic != SAVE_MAGIC || version != SAVE_VERSION) {
+        std::cerr << "Error: Unsupported world data in save file (expected format version "
+                  << SAVE_VERSION << ")." << std::endl;
+        return false;
+    }
 
+    // Stage every record (layers only, palette-packed) so a truncated file is
+    // rejected before anything is cleared
     size_t count = 0;
     file.read(reinterpret_cast<char*>(&count), sizeof(count));
 
+    std::vector<std::pair<int, std::unique_ptr<Chunk>>> loaded;
     for (size_t i = 0; i < count; ++i) {
         int chunkX = 0;
         file.read(reinterpret_cast<char*>(&chunkX), sizeof(chunkX));
 
-        std::vector<int> blocks(CHUNK_WIDTH * WORLD_HEIGHT);
-        std::vector<int> walls(CHUNK_WIDTH * WORLD_HEIGHT);
+        auto chunk = std::make_unique<Chunk>();
+        if (!file || !readChunkLayers(file, *chunk)) {
+            std::cerr << "Error: Save file ends inside chunk record " << i << " of " << count << "." << std::endl;
+            return false;
+        }
+        loaded.emplace_back(chunkX, std::move(chunk));
+    }
 
-        file.read(reinterpret_cast<char*>(blocks.data()), blocks.size() * sizeof(int));
-        file.read(reinterpret_cast<char*>(walls.data()), walls.size() * sizeof(int));
+    mChunks.clear();
+    mMeshes.clear();
+    clearChunkCache();
+    mItems.clear(); // Clear dropped items to prevent load-duplication
+    mSleepingDrops.clear();
+
+    // Chunks missing from the save are regenerated from the saved seed
+    mGenerator.setSeed(seed);
+
+    for (auto& [chunkX, chunk] : loaded) {
+        finishLoadedChunk(*chunk, mGenerator.getTerrain(), chunkX);
 
-        mChunks[chunkX] = blocks;
-        mBackgroundChunks[chunkX] = walls;
+        // Saved chunks have no cached copy yet
+        chunk->dirty = true;
+        if (mChunks.size() >= mResidentBudget && spillChunk(chunkX, *chunk)) continue;
+
+        onChunkCompleted(chunkX, mChunks.insert(chunkX, std::move(chunk)));
     }
+    return true;
 }
 
 // ==========================================
-// ESCÁNER DE VECINOS (BITMASKING UNIVERSAL Y FUSIÓN)
+// AUTOTILE MASKS
 // ==========================================
-int World::getBitmask(int x, int y, int targetID) {
-    int mask = 0;
-
-    int top    = getBlock(x, y - 1);
-    int right  = getBlock(x + 1, y);
-    int bottom = getBlock(x, y + 1);
-    int left   = getBlock(x - 1, y);
-
-    // --- NUEVO: REGLAS DE FUSIÓN ENTRE DISTINTOS BLOQUES ----
-    auto connects = [&](int neighbor) {
-        // 1. Siempre nos conectamos perfectamente con nosotros mismos
-        if (neighbor == targetID) return true;
-
-        // 2. Regla de la Tierra y Hojas: Se fusionan con TODOS los bloques
-        if (targetID == ItemID::DIRT || targetID == ItemID::LEAVES) {
-            // Se fusionan con cualquier cosa que NO sea Aire y NO sea una Antorcha
-            if (neighbor != ItemID::AIR && neighbor != ItemID::TORCH) {
-                return true;
+
+int World::computeMask(int x, int y) {
+    if (y < 0 || y >= WORLD_HEIGHT) return 0;
+
+    const Chunk* chunk = findCompleteChunk(x >> CHUNK_SHIFT);
+    if (!chunk) return 0;
+    int targetID = chunk->blocks.get(y * CHUNK_WIDTH + (x & CHUNK_MASK));
+
+    // Horizontal neighbours may sit in another chunk: peek without generating it
+    auto sideBlock = [&](int nx) {
+        const Chunk* side = findCompleteChunk(nx >> CHUNK_SHIFT);
+        return side ? side->blocks.get(y * CHUNK_WIDTH + (nx & CHUNK_MASK)) : targetID;
+    };
+    auto columnBlock = [&](int ny) {
+        return (ny < 0 || ny >= WORLD_HEIGHT) ? static_cast<int>(ItemID::AIR) : chunk->blocks.get(ny * CHUNK_WIDTH + (x & CHUNK_MASK));
+    };
+
+    return autotileMask(targetID, columnBlock(y - 1), sideBlock(x + 1), columnBlock(y + 1), sideBlock(x - 1));
+}
+
+/**
+ * @brief One pass over the unpacked layer. Border columns read the neighbour
+ * chunks when they are resident; otherwise the neighbour fixes this column up
+ * when it arrives (see the refresh at the end).
+ */
+void World::buildMasks(int chunkX, Chunk& chunk) {
+    std::vector<int> ids = chunk.blocks.toVector();
+    const Chunk* leftChunk = findCompleteChunk(chunkX - 1);
+    const Chunk* rightChunk = findCompleteChunk(chunkX + 1);
+
+    chunk.masks.assign(CHUNK_WIDTH * WORLD_HEIGHT, 0);
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+            int index = y * CHUNK_WIDTH + lx;
+            int targetID = ids[index];
+
+            int top = (y > 0) ? ids[index - CHUNK_WIDTH] : ItemID::AIR;
+            int bottom = (y < WORLD_HEIGHT - 1) ? ids[index + CHUNK_WIDTH] : ItemID::AIR;
+            int left = (lx > 0) ? ids[index - 1]
+                     : (leftChunk ? leftChunk->blocks.get(y * CHUNK_WIDTH + CHUNK_WIDTH - 1) : targetID);
+            int right = (lx < CHUNK_WIDTH - 1) ? ids[index + 1]
+                      : (rightChunk ? rightChunk->blocks.get(y * CHUNK_WIDTH) : targetID);
+
+            chunk.masks[index] = static_cast<uint8_t>(autotileMask(targetID, top, right, bottom, left));
+        }
+    }
+
+    // The neighbours' facing columns may have been built while this chunk was missing
+    int firstX = chunkX * CHUNK_WIDTH;
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        if (leftChunk) updateMask(firstX - 1, y);
+        if (rightChunk) updateMask(firstX + CHUNK_WIDTH, y);
+    }
+}
+
+void World::updateMask(int x, int y) {
+    if (y < 0 || y >= WORLD_HEIGHT) return;
+
+    int chunkX = x >> CHUNK_SHIFT;
+    Chunk* chunk = findCompleteChunk(chunkX);
+    if (!chunk || chunk->masks.empty()) return;
+
+    uint8_t mask = static_cast<uint8_t>(computeMask(x, y));
+    uint8_t& cached = chunk->masks[y * CHUNK_WIDTH + (x & CHUNK_MASK)];
+    if (cached == mask) return;
+
+    cached = mask;
+    invalidateMesh(x, y);
+}
+
+// ==========================================
+// SOLIDITY
+// ==========================================
+
+void World::buildSolidRows(Chunk& chunk) {
+    chunk.solid.assign(WORLD_HEIGHT, 0);
+    for (int y = 0; y < WORLD_HEIGHT; ++y) {
+        uint16_t row = 0;
+        for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+            if (isSolid(chunk.blocks.get(y * CHUNK_WIDTH + lx))) row |= static_cast<uint16_t>(1u << lx);
+        }
+        chunk.solid[y] = row;
+    }
+}
+
+bool World::isSolidAt(int x, int y) {
+    if (y < 0 || y >= WORLD_HEIGHT) return false;
+
+    const Chunk& chunk = getChunk(x >> CHUNK_SHIFT);
+    return (chunk.solid[y] >> (x & CHUNK_MASK)) & 1u;
+}
+
+/**
+ * @brief Walks the rectangle one chunk slice at a time. Chunks that only reached
+ * an earlier stage have no bitsets yet and fall back to testing each block.
+ */
+bool World::isAreaSolid(int left, int top, int width, int height, ChunkStage stage) {
+    int right = left + width;  // Exclusive
+    int bottom = std::min(top + height, WORLD_HEIGHT);
+    top = std::max(top, 0);
+
+    for (int x = left; x < right; ) {
+        int firstCol = x & CHUNK_MASK;
+        int lastCol = std::min(CHUNK_WIDTH, firstCol + (right - x)) - 1;
+        const Chunk& chunk = getChunk(x >> CHUNK_SHIFT, stage);
+
+        if (!chunk.solid.empty()) {
+            uint16_t mask = chunkColumnMask(firstCol, lastCol);
+            for (int y = top; y < bottom; ++y) {
+                if (chunk.solid[y] & mask) return true;
+            }
+        } else {
+            for (int y = top; y < bottom; ++y) {
+                for (int lx = firstCol; lx <= lastCol; ++lx) {
+                    if (isSolid(chunk.blocks.get(y * CHUNK_WIDTH + lx))) return true;
+                }
             }
         }
+        x += lastCol - firstCol + 1;
+    }
+    return false;
+}
 
-        // (En el futuro, si haces Autotile para la Piedra, añadirás su regla aquí)
-        // if (targetID == ItemID::STONE) { ... }
+/**
+ * @brief Steps to whichever tile boundary (vertical or horizontal) the segment
+ * reaches first. The chunk is looked up only when the walk crosses into another one.
+ */
+World::RaycastHit World::raycast(sf::Vector2f from, sf::Vector2f to, ChunkStage stage) {
+    RaycastHit result;
+    result.point = to;
+
+    sf::Vector2f delta = to - from;
+    int x = static_cast<int>(std::floor(from.x / mTileSize));
+    int y = static_cast<int>(std::floor(from.y / mTileSize));
+    int endX = static_cast<int>(std::floor(to.x / mTileSize));
+    int endY = static_cast<int>(std::floor(to.y / mTileSize));
+
+    const float inf = std::numeric_limits<float>::infinity();
+    int stepX = (delta.x > 0.0f) ? 1 : (delta.x < 0.0f ? -1 : 0);
+    int stepY = (delta.y > 0.0f) ? 1 : (delta.y < 0.0f ? -1 : 0);
+
+    // Fraction of the segment to the next boundary on each axis, and between two boundaries
+    float nextX = (stepX == 0) ? inf : (((stepX > 0 ? x + 1 : x) * mTileSize) - from.x) / delta.x;
+    float nextY = (stepY == 0) ? inf : (((stepY > 0 ? y + 1 : y) * mTileSize) - from.y) / delta.y;
+    float spanX = (stepX == 0) ? inf : mTileSize / std::abs(delta.x);
+    float spanY = (stepY == 0) ? inf : mTileSize / std::abs(delta.y);
+
+    const Chunk* chunk = nullptr;
+    int chunkX = 0;
+    float t = 0.0f;
+    int steps = std::abs(endX - x) + std::abs(endY - y);
+
+    for (int i = 0; ; ++i) {
+        if (y >= 0 && y < WORLD_HEIGHT) {
+            if (!chunk || (x >> CHUNK_SHIFT) != chunkX) {
+                chunkX = x >> CHUNK_SHIFT;
+                chunk = &getChunk(chunkX, stage);
+            }
 
-        return false; // Si no cumple nada, no nos fusionamos
-    };
+            int lx = x & CHUNK_MASK;
+            bool solid = chunk->solid.empty() ? isSolid(chunk->blocks.get(y * CHUNK_WIDTH + lx))
+                                              : ((chunk->solid[y] >> lx) & 1u) != 0;
+            if (solid) {
+                result.hit = true;
+                result.tile = sf::Vector2i(x, y);
+                result.point = from + delta * t;
+                return result;
+            }
+        }
+        if (i == steps) break;
 
-    // Evaluamos a los 4 vecinos con nuestras nuevas reglas
-    if (connects(top))    mask += 1;
-    if (connects(right))  mask += 2;
-    if (connects(bottom)) mask += 4;
-    if (connects(left))   mask += 8;
+        if (nextX < nextY) {
+            t = nextX;
+            nextX += spanX;
+            x += stepX;
+            result.normal = sf::Vector2f(static_cast<float>(-stepX), 0.0f);
+        } else {
+            t = nextY;
+            nextY += spanY;
+            y += stepY;
+            result.normal = sf::Vector2f(0.0f, static_cast<float>(-stepY));
+        }
+    }
 
-    return mask;
+    result.normal = sf::Vector2f();
+    return result;
 }
 
 // ==========================================
-// FÍSICAS DE BLOQUES (COLISIONES)
+// LIGHTING
 // ==========================================
-bool World::isSolid(int blockID) {
-    return (blockID != ItemID::AIR && blockID != ItemID::WOOD &&
-            blockID != ItemID::LEAVES && blockID != ItemID::TORCH &&
-            blockID != ItemID::DOOR_OPEN && blockID != ItemID::DOOR_OPEN_MID &&
-            blockID != ItemID::DOOR_OPEN_TOP);
-}
\ No newline at end of file
+
+void World::buildSkyTops(Chunk& chunk) {
+    chunk.skyTop.assign(CHUNK_WIDTH, static_cast<uint8_t>(WORLD_HEIGHT));
+    for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+        for (int y = 0; y < WORLD_HEIGHT; ++y) {
+            if (isSolid(chunk.blocks.get(y * CHUNK_WIDTH + lx))) {
+                chunk.skyTop[lx] = static_cast<uint8_t>(y);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief A solid block above the top becomes the new top; removing the top
+ * block scans down for the next solid one. Edits below the top change nothing.
+ */
+void World::updateSkyTop(int x, int y) {
+    Chunk* chunk = findCompleteChunk(x >> CHUNK_SHIFT);
+    if (!chunk || chunk->skyTop.empty()) return;
+
+    int lx = x & CHUNK_MASK;
+    int top = chunk->skyTop[lx];
+
+    if (isSolid(chunk->blocks.get(y * CHUNK_WIDTH + lx))) {
+        if (y < top) chunk->skyTop[lx] = static_cast<uint8_t>(y);
+        return;
+    }
+    if (y != top) return;
+
+    int newTop = y + 1;
+    while (newTop < WORLD_HEIGHT && !isSolid(chunk->blocks.get(newTop * CHUNK_WIDTH + lx))) newTop++;
+    chunk->skyTop[lx] = static_cast<uint8_t>(newTop);
+}
+
+float World::getSkyLight(int x, int y) {
+    const Chunk* chunk = findCompleteChunk(x >> CHUNK_SHIFT);
+    if (!chunk || chunk->skyTop.empty()) return 1.0f;
+
+    float depth = static_cast<float>(y - chunk->skyTop[x & CHUNK_MASK]);
+    return 1.0f - std::clamp(depth / SKY_FADE_DEPTH, 0.0f, 1.0f);
+}
+
+sf::Color World::getLightColor(sf::Vector2f position, sf::Color skyColor) {
+    int tileX = static_cast<int>(std::floor(position.x / mTileSize));
+    int tileY = static_cast<int>(std::floor(position.y / mTileSize));
+
+    // Skylight darkens progressively below the column's highest solid block
+    float sky = getSkyLight(tileX, tileY);
+    float r = std::max(MIN_AMBIENT, skyColor.r * sky);
+    float g = std::max(MIN_AMBIENT, skyColor.g * sky);
+    float b = std::max(MIN_AMBIENT, skyColor.b * sky);
+
+    // Torch light (Warm fire colors: Max Red, High Green, Low Blue)
+    float intensity = mLight.getLevel(tileX, tileY) / static_cast<float>(LightEngine::MAX_LIGHT);
+
+    // Screen blending: Choose the brightest value between ambient daylight and torchlight
+    r = std::max(r, intensity * 255.0f);
+    g = std::max(g, intensity * 200.0f);
+    b = std::max(b, intensity * 120.0f);
+
+    // Clamp to prevent visual overflow
+    return sf::Color(static_cast<sf::Uint8>(std::min(r, 255.0f)),
+                     static_cast<sf::Uint8>(std::min(g, 255.0f)),
+                     static_cast<sf::Uint8>(std::min(b, 255.0f)));
+}
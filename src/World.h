@@ -1,19 +1,65 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include "ChunkStore.h"
+#include "ChunkGenerator.h"
+#include "ChunkMesh.h"
+#include "ItemTable.h"
+#include "LightEngine.h"
+#include "TextureAtlas.h"
+#include "TileCollision.h"
 
 
 // World generation constants
 const int CHUNK_WIDTH = 16;
 const int WORLD_HEIGHT = 150; // Fixed vertical height (Sky to Bedrock)
 
+// Chunk coordinate math (CHUNK_WIDTH must stay a power of two).
+// An arithmetic right shift floors negative coordinates (x = -5 -> chunk -1),
+// and the mask wraps them into the 0-15 local range without a modulo.
+const int CHUNK_SHIFT = 4;
+const int CHUNK_MASK = CHUNK_WIDTH - 1;
+static_assert((1 << CHUNK_SHIFT) == CHUNK_WIDTH, "CHUNK_SHIFT must match CHUNK_WIDTH");
+static_assert(CHUNK_WIDTH <= 16, "Chunk::solid stores a chunk row in 16 bits");
+
+/**
+ * @brief Bits of the local columns firstCol..lastCol (inclusive) in a Chunk::solid row.
+ */
+inline uint16_t chunkColumnMask(int firstCol, int lastCol) {
+    return static_cast<uint16_t>(((2u << lastCol) - 1u) & ~((1u << firstCol) - 1u));
+}
+
+// Chunk residency defaults
+const size_t DEFAULT_RESIDENT_CHUNKS = 96; // Chunks kept in memory before LRU eviction starts
+const int CHUNK_KEEP_RADIUS = 6;           // Chunks this close to the player are never evicted
+
+// Chunk meshes
+const int MESH_SECTION_HEIGHT = 16; // Rows per cached vertex array
+const int MESH_SECTION_COUNT = (WORLD_HEIGHT + MESH_SECTION_HEIGHT - 1) / MESH_SECTION_HEIGHT;
+const int MESH_KEEP_MARGIN = 2;     // Chunks beyond the visible range that keep their meshes
+
+// Lighting
+const int SKY_FADE_DEPTH = 20; // Tiles below a column's highest solid block until skylight is gone
+const int LIGHTMAP_MARGIN = 1; // Lightmap texels computed beyond each edge of the view
+
+// Item drops
+const float DROP_BUCKET_SIZE = 128.0f; // Cell size of the sleeping-drop grid (>= the magnet range)
+const float DROP_MERGE_RADIUS = 24.0f; // Identical resting drops closer than this become one stack
+
+// Background generation
+const int PREFETCH_RADIUS = 3;            // Chunks generated around the focus point
+const float PREFETCH_LOOKAHEAD = 1.5f;    // Seconds of travel generated ahead of the camera
+
 /**
  * @struct ItemDrop
  * @brief Represents an item physically dropped in the game world.
  */
 struct ItemDrop {
     int id;           // Item/Block ID
+    int count = 1;    // Stack size (identical drops merge when they come to rest)
     sf::Vector2f pos; // Drop position
     sf::Vector2f vel; // Physical velocity for tossing/bouncing
     float timeAlive;  // Time elapsed since dropped (for despawning/floating animation)
@@ -25,30 +71,58 @@ struct ItemDrop {
  *
  * Uses an infinite horizontal chunk system. Chunks are generated on the fly
  * as the player requests blocks outside previously loaded areas.
+ *
+ * Only a bounded number of chunks stays in memory: once the resident budget is
+ * exceeded, the least recently used chunks far from the player are evicted.
+ * Modified chunks are spilled to an on-disk cache first and transparently
+ * reloaded on their next access.
+ *
+ * New chunks are normally generated by a background worker pool ahead of the
+ * camera (see streamChunks). A chunk demanded before it is ready is generated
+ * synchronously on the spot, and only up to the stage the query needs
+ * (see ChunkStage): far-field lookups leave it partially generated.
  */
 class World {
 public:
     /**
      * @brief Constructs a new World object.
      * Sets tile sizes and loads textures.
+     * @param seed World seed. The same seed always generates the same terrain.
+     */
+    explicit World(uint64_t seed);
+
+    /**
+     * @brief Renders the visible portion of the world (culling) and dropped items, unlit.
+     * @param window The render window.
      */
-    World();
+    void render(sf::RenderWindow& window);
 
     /**
-     * @brief Renders the visible portion of the world (culling) and dropped items.
+     * @brief Darkens everything drawn so far with the world's light, in one
+     * multiplicative draw of a smoothed one-texel-per-tile lightmap.
+     * Call it after the world and entities, before the UI.
      * @param window The render window.
-     * @param ambientColor The global ambient light color for coloring blocks.
+     * @param skyColor The global daylight/nightlight color.
      */
-    void render(sf::RenderWindow& window, sf::Color ambientColor);
+    void renderLighting(sf::RenderWindow& window, sf::Color skyColor);
 
     /**
      * @brief Gets the block type at a specific coordinate.
      * Generates the chunk automatically if it doesn't exist.
      * @param x Global grid X coordinate.
      * @param y Global grid Y coordinate.
+     * @param stage Generation stage the answer needs. Far-field queries that only
+     * care about the terrain shape can pass an earlier stage so the chunk is not
+     * fully generated (caves, ores and trees are skipped until needed).
      * @return The ID of the block at that location.
      */
-    int getBlock(int x, int y);
+    int getBlock(int x, int y, ChunkStage stage = ChunkStage::Complete);
+
+    /**
+     * @brief Surface row of a column: the first block of a resident Complete
+     * chunk, or the generation heightmap if the chunk is not in memory.
+     */
+    int getSurfaceHeight(int x);
 
     /**
      * @brief Sets the block type at a specific coordinate.
@@ -61,19 +135,27 @@ public:
     float getTileSize() const { return mTileSize; }
 
     /**
-     * @brief Gets the UI icon texture for a specific ItemID.
+     * @brief Swept box collision against the resident tiles (shared by the player and every mob).
      */
-    const sf::Texture* getTexture(int id) const;
+    const TileCollision& getCollision() const { return mCollision; }
+    uint64_t getSeed() const { return mGenerator.getTerrain().getSeed(); }
 
     /**
-     * @brief Gets the specialized texture for rendering a tool held in the player's hand.
+     * @brief Gets the atlas region of the block/UI icon image for a specific ItemID.
+     * Every image lives in the shared texture atlas, so icons of different items
+     * can be drawn in one batch. The region's texture is nullptr if the item has no image.
      */
-    const sf::Texture* getHeldTexture(int id) const;
+    TextureAtlas::Region getItemRegion(int id) const;
 
     /**
-     * @brief Gets the spritesheet texture for animated armor layers.
+     * @brief Gets the specialized image for rendering a tool held in the player's hand.
      */
-    const sf::Texture* getArmorAnimTexture(int id) const;
+    TextureAtlas::Region getHeldRegion(int id) const;
+
+    /**
+     * @brief Gets the spritesheet for animated armor layers.
+     */
+    TextureAtlas::Region getArmorAnimRegion(int id) const;
 
     /**
      * @brief Updates physics for dropped items and handles player pickup.
@@ -84,57 +166,285 @@ public:
     void update(sf::Time dt, sf::Vector2f playerPos, std::map<int, int>& inventory);
 
     // --- SAVE AND LOAD ---
+    static const uint32_t SAVE_MAGIC = 0x44574654;  // "TFWD" in the file (little-endian)
+    static const uint32_t SAVE_VERSION = 1;         // Bump when the world section layout changes
+
     void saveToStream(std::ofstream& file);
-    void loadFromStream(std::ifstream& file);
+
+    /**
+     * @brief Replaces the world with the one in the stream.
+     * @return False (and the current world untouched) if the section does not
+     * start with SAVE_MAGIC and SAVE_VERSION, e.g. a save from an older build,
+     * or if a chunk record is truncated.
+     */
+    bool loadFromStream(std::ifstream& file);
+
+    // --- CHUNK RESIDENCY ---
+    /**
+     * @brief Sets how many chunks may stay in memory before LRU eviction starts.
+     */
+    void setResidentChunkBudget(size_t budget) { mResidentBudget = budget; }
+    size_t getResidentChunkBudget() const { return mResidentBudget; }
+
+    size_t getResidentChunkCount() const { return mChunks.size(); }
+    size_t getSpilledChunkCount() const { return mSpilledChunks.size(); }
+    size_t getEvictionCount() const { return mEvictionCount; }
+
+    /**
+     * @brief Evictions per second, averaged over the last second.
+     */
+    float getEvictionRate() const { return mEvictionRate; }
+
+    // --- BACKGROUND GENERATION ---
+    /**
+     * @brief Publishes chunks finished by the worker pool and queues the ones
+     * the camera is about to need. Call once per frame.
+     * @param focus World position the camera follows (pixels).
+     * @param velocity Its velocity (pixels/s); chunks in the direction of travel come first.
+     */
+    void streamChunks(sf::Vector2f focus, sf::Vector2f velocity);
+
+    size_t getQueuedChunkCount() const { return mGenerator.getQueuedCount(); }
+    size_t getAsyncGeneratedCount() const { return mAsyncGenerated; }
+    size_t getSyncGeneratedCount() const { return mSyncGenerated; }
+    size_t getPartialGeneratedCount() const { return mPartialGenerated; }
+
+    /**
+     * @brief Draw calls issued by the last render() and renderLighting() (chunk sections, dropped items, lightmap).
+     */
+    size_t getDrawCallCount() const { return mDrawCalls; }
 
     /**
      * @brief Spawns an item drop at an exact pixel position.
+     * @param count Stack size of the drop.
      */
-    void spawnItem(int id, sf::Vector2f pos);
+    void spawnItem(int id, sf::Vector2f pos, int count = 1);
 
     /**
      * @brief Spawns an item drop at a grid coordinate (centered).
+     * @param count Stack size of the drop.
      */
-    void spawnItem(int x, int y, int id);
+    void spawnItem(int x, int y, int id, int count = 1);
 
     /**
      * @brief Static helper to check if a given block ID has physical collision.
      * @param blockID The ID of the block to check.
      * @return True if the block is solid (collidable), false if passable (Air, Wood background, Open doors).
      */
-    static bool isSolid(int blockID);
+    static bool isSolid(int blockID) { return itemProperties(blockID).solid; }
+
+    /**
+     * @brief True if the block at a grid coordinate is solid (one bit test in a
+     * Complete chunk). Generates the chunk like getBlock; rows outside the world are open.
+     */
+    bool isSolidAt(int x, int y);
+
+    /**
+     * @brief True if any block in a tile rectangle is solid. Each chunk row the
+     * rectangle covers is tested as one masked word.
+     * @param stage Generation stage the answer needs (see getBlock).
+     */
+    bool isAreaSolid(int left, int top, int width, int height, ChunkStage stage = ChunkStage::Complete);
+
+    /**
+     * @struct RaycastHit
+     * @brief First solid tile crossed by a segment.
+     */
+    struct RaycastHit {
+        bool hit = false;
+        sf::Vector2i tile;   // Grid coordinates of the tile hit
+        sf::Vector2f point;  // Where the segment enters the tile (the segment's end if nothing was hit)
+        sf::Vector2f normal; // Face entered, pointing back at the origin (zero if the segment starts inside)
+    };
+
+    /**
+     * @brief Walks the tiles a segment crosses, in order (Amanatides-Woo DDA),
+     * and stops at the first solid one. Generates chunks like getBlock.
+     * @param stage Generation stage the answer needs (see getBlock).
+     */
+    RaycastHit raycast(sf::Vector2f from, sf::Vector2f to, ChunkStage stage = ChunkStage::Complete);
+
+    /**
+     * @brief True if no solid tile lies between two points (AI line of sight).
+     */
+    bool hasLineOfSight(sf::Vector2f from, sf::Vector2f to) { return !raycast(from, to).hit; }
+
+    /**
+     * @brief Fraction of skylight reaching a tile (1 at and above the column's
+     * highest solid block, fading to 0 over SKY_FADE_DEPTH tiles below it).
+     */
+    float getSkyLight(int x, int y);
+
+    /**
+     * @brief Final light color at a world position: skylight tinted by the
+     * time-of-day color, brightened by torch light.
+     * @param skyColor Daylight/nightlight color of the open sky.
+     */
+    sf::Color getLightColor(sf::Vector2f position, sf::Color skyColor);
 
 private:
     /**
-     * @brief Procedurally generates a new chunk of terrain.
-     * @param chunkX The chunk index to generate.
+     * @brief Returns a chunk generated at least up to stage, generating it
+     * first if it is not in memory or not far enough along.
+     */
+    Chunk& getChunk(int chunkX, ChunkStage stage = ChunkStage::Complete) {
+        Chunk* chunk = mChunks.find(chunkX);
+        if (!chunk || chunk->stage < stage) chunk = &loadOrGenerateChunk(chunkX, stage);
+        chunk->lastUsed = mFrameCounter; // LRU stamp
+        return *chunk;
+    }
+
+    /**
+     * @brief Brings a missing chunk back from the disk cache, or generates it
+     * synchronously up to stage (the worker pool did not deliver it in time).
+     * Partially generated resident chunks are advanced in place.
+     */
+    Chunk& loadOrGenerateChunk(int chunkX, ChunkStage stage);
+
+    /**
+     * @brief Prepares a chunk that just became Complete (resident): autotile masks and light.
      */
-    void generateChunk(int chunkX);
+    void onChunkCompleted(int chunkX, Chunk& chunk);
+
+    /**
+     * @brief Advances the LRU clock and evicts chunks while over budget.
+     * @param dt Time elapsed (used for the eviction rate counter).
+     * @param focusChunk The chunk the player stands in.
+     */
+    void updateResidency(sf::Time dt, int focusChunk);
+
+    /**
+     * @brief Removes a chunk from memory, spilling it to disk first if modified.
+     * @return False if the spill failed (the chunk then stays resident).
+     */
+    bool evictChunk(int chunkX, Chunk& chunk);
+
+    bool spillChunk(int chunkX, const Chunk& chunk);
+    bool readSpilledChunk(int chunkX, Chunk& chunk) const;
+
+    /**
+     * @brief Deletes every spilled chunk file of this world.
+     */
+    void clearChunkCache();
 
     /**
      * @brief Loads all textures for blocks, items, tools, and armor.
      */
     void loadTextures();
 
+    // --- CHUNK MESHES ---
+    /**
+     * @brief Rebuilds the quads of one mesh section from the chunk's layers.
+     */
+    void buildMeshSection(int chunkX, const Chunk& chunk, int section, ChunkMesh::Section& out);
+
+    /**
+     * @brief Flags the mesh section showing a tile.
+     */
+    void invalidateMesh(int x, int y);
+
     // --- DATA ---
     float mTileSize;
 
-    // THE CHUNK MAPS
+    // Worker pool; also owns the terrain algorithm for the current seed
+    ChunkGenerator mGenerator;
+    size_t mAsyncGenerated;
+    size_t mSyncGenerated;
+    size_t mPartialGenerated; // Synchronous requests that stopped before the Complete stage
+
+    // THE CHUNK STORE
     // Key: Chunk Coordinate (X)
-    // Value: 1D Array representing the 2D grid of blocks in that chunk (Width * Height)
-    std::map<int, std::vector<int>> mChunks;
-    std::map<int, std::vector<int>> mBackgroundChunks; // Back wall layers
+    // Value: Foreground blocks and back wall layer of that chunk (Width * Height each)
+    ChunkStore mChunks;
+    LightEngine mLight; // Block light of the resident chunks (declared after mChunks, which it reads)
+    TileCollision mCollision; // Entity-vs-tile sweeps over the resident chunks
 
-    // Graphics Resources
-    std::map<int, sf::Texture> mTextures;          // Icons and block textures
-    std::map<int, sf::Texture> mHeldTextures;      // Hand-held weapon/tool textures
-    std::map<int, sf::Texture> mArmorAnimTextures; // Animated spritesheets for armor pieces
+    // Residency bookkeeping
+    size_t mResidentBudget;
+    uint64_t mFrameCounter;                // LRU clock, advanced once per frame
+    std::unordered_set<int> mSpilledChunks; // Chunk indices with a file in the disk cache
+    size_t mEvictionCount;
+    size_t mEvictionsThisWindow;
+    float mEvictionWindowTimer;
+    float mEvictionRate;
 
+    // Graphics Resources
     sf::Sprite mSprite; // Shared sprite instance for high-performance rendering
 
+    // Every block, icon, held tool, armor and autotile image, packed at startup.
+    // Blocks are added first so chunk meshes only need page 0.
+    TextureAtlas mAtlas;
+    std::unordered_map<int, ChunkMesh> mMeshes; // Key: chunk index (only chunks near the view)
+    size_t mDrawCalls;
+
+    // Lightmap (one texel per tile of the view, refilled every frame)
+    std::vector<sf::Uint8> mLightPixels; // RGBA
+    sf::Texture mLightTexture;
+
     // Dynamic Entities
+    // Drops in motion are simulated every frame. Drops at rest on the ground
+    // sleep in a bucket grid: no physics, and only the buckets around the
+    // player (magnet), around an edited tile or inside the view are visited.
     std::vector<ItemDrop> mItems;
-    // --- NUEVO: SISTEMA DE AUTOTILING ---
-    std::map<int, sf::Texture> mAutotileTextures; // Guarda las texturas inteligentes
-    int getBitmask(int x, int y, int targetID);
+    std::unordered_map<int64_t, std::vector<ItemDrop>> mSleepingDrops; // Key: dropBucketKey()
+
+    static int64_t dropBucketKey(int bucketX, int bucketY) {
+        return (static_cast<int64_t>(bucketX) << 32) | static_cast<uint32_t>(bucketY);
+    }
+
+    /**
+     * @brief Puts a resting drop to sleep, merging it into an identical sleeping drop nearby.
+     */
+    void sleepDrop(const ItemDrop& item);
+
+    /**
+     * @brief Moves the sleeping drops within radius of center back into simulation.
+     */
+    void wakeDrops(sf::Vector2f center, float radius);
+
+    // --- AUTOTILING ---
+    // Sheets live in mAtlas; the mask picks the frame from the 4 neighbours.
+    // Masks are cached in Chunk::masks and only recomputed around edits.
+
+    /**
+     * @brief Computes the mask of one tile. Never generates chunks: a neighbour
+     * column in a chunk that is not resident is assumed to connect.
+     */
+    int computeMask(int x, int y);
+
+    /**
+     * @brief Fills the masks of a newly Complete chunk and refreshes
+     * the facing border column of each resident neighbour.
+     */
+    void buildMasks(int chunkX, Chunk& chunk);
+
+    /**
+     * @brief Recomputes the cached mask of one tile, flagging its mesh section if it changed.
+     */
+    void updateMask(int x, int y);
+
+    // --- SOLIDITY ---
+    /**
+     * @brief Fills Chunk::solid for every row of a newly Complete chunk.
+     */
+    void buildSolidRows(Chunk& chunk);
+
+    // --- SKYLIGHT ---
+    /**
+     * @brief Fills Chunk::skyTop for every column of a newly Complete chunk.
+     */
+    void buildSkyTops(Chunk& chunk);
+
+    /**
+     * @brief Keeps a column's skyTop current after the block at (x, y) changed.
+     */
+    void updateSkyTop(int x, int y);
+
+    /**
+     * @brief Returns a resident chunk that is Complete, or nullptr (never generates).
+     */
+    Chunk* findCompleteChunk(int chunkX) {
+        Chunk* chunk = mChunks.find(chunkX);
+        return (chunk && chunk->stage == ChunkStage::Complete) ? chunk : nullptr;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "BlockStorage.h"
+#include <cstdio>
+#include <random>
+
+/**
+ * Unit tests for BlockStorage: layers are written with assign() or set() and
+ * read back cell by cell. The interesting cases sit on the palette limits,
+ * where Air (always palette index 0) decides whether a width still fits.
+ */
+
+namespace {
+    const int CELLS = 16 * 150; // One chunk layer
+    int failures = 0;
+
+    #define CHECK(cond) do { \
+        if (!(cond)) { std::printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+    } while (0)
+
+    /**
+     * @brief A layer cycling through 'distinct' IDs, optionally with Air cells mixed in.
+     */
+    std::vector<int> makeLayer(int distinct, bool withAir) {
+        std::vector<int> ids(CELLS);
+        for (int i = 0; i < CELLS; ++i) ids[i] = 1 + (i * 7) % distinct;
+        if (withAir) {
+            for (int i = 0; i < CELLS; i += 5) ids[i] = 0;
+        }
+        return ids;
+    }
+
+    int mismatches(const BlockStorage& storage, const std::vector<int>& ids) {
+        int wrong = 0;
+        for (int i = 0; i < CELLS; ++i) wrong += (storage.get(i) != ids[i]);
+        return wrong + (storage.toVector() != ids);
+    }
+
+    void testAssignRoundTrip() {
+        struct Case { int distinct; bool withAir; int bits; };
+        const Case cases[] = {
+            {1, false, 4}, {15, false, 4}, {15, true, 4},
+            {16, false, 8}, {16, true, 8},    // Air makes 17 palette entries either way
+            {255, false, 8}, {255, true, 8},
+            {256, false, 16}, {256, true, 16},
+            {1000, false, 16}
+        };
+        for (const Case& c : cases) {
+            std::vector<int> ids = makeLayer(c.distinct, c.withAir);
+            BlockStorage storage(CELLS);
+            storage.assign(ids);
+            CHECK(mismatches(storage, ids) == 0);
+            CHECK(storage.getBitsPerCell() == c.bits);
+        }
+    }
+
+    void testSetWidens() {
+        BlockStorage storage(CELLS);
+        std::vector<int> ids(CELLS, 0);
+        CHECK(mismatches(storage, ids) == 0);
+
+        // Introduce IDs one at a time across both width changes
+        std::mt19937 rng(5);
+        for (int id = 1; id <= 300; ++id) {
+            for (int n = 0; n < 8; ++n) {
+                int index = static_cast<int>(rng() % CELLS);
+                storage.set(index, id);
+                ids[index] = id;
+            }
+            if (id == 15) CHECK(storage.getBitsPerCell() == 4);
+            if (id == 16) CHECK(storage.getBitsPerCell() == 8);
+            if (id == 255) CHECK(storage.getBitsPerCell() == 8);
+            if (id == 256) CHECK(storage.getBitsPerCell() == 16);
+        }
+        CHECK(mismatches(storage, ids) == 0);
+    }
+
+    void testOverwrite() {
+        std::vector<int> ids = makeLayer(16, false);
+        BlockStorage storage(CELLS);
+        storage.assign(ids);
+        for (int i = 0; i < CELLS; i += 3) {
+            ids[i] = (i % 2) ? 0 : 16;
+            storage.set(i, ids[i]);
+        }
+        CHECK(mismatches(storage, ids) == 0);
+    }
+}
+
+int main() {
+    testAssignRoundTrip();
+    testSetWidens();
+    testOverwrite();
+
+    if (failures == 0) std::printf("BlockStorage: all tests passed\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+/**
+ * Unit tests for SpatialGrid: every query is compared against a brute-force
+ * scan of the same bounds. Small bucket counts force unrelated cells into the
+ * same bucket, so the exact filtering after the hash lookup is exercised too.
+ */
+
+namespace {
+    int failures = 0;
+
+    #define CHECK(cond) do { \
+        if (!(cond)) { std::printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+    } while (0)
+
+    std::vector<size_t> bruteRect(const std::vector<sf::FloatRect>& bounds, const sf::FloatRect& area) {
+        std::vector<size_t> ids;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            if (bounds[i].intersects(area)) ids.push_back(i);
+        }
+        return ids;
+    }
+
+    std::vector<size_t> bruteRadius(const std::vector<sf::FloatRect>& bounds, sf::Vector2f center, float radius) {
+        std::vector<size_t> ids;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            const sf::FloatRect& b = bounds[i];
+            float dx = center.x - std::clamp(center.x, b.left, b.left + b.width);
+            float dy = center.y - std::clamp(center.y, b.top, b.top + b.height);
+            if (dx * dx + dy * dy <= radius * radius) ids.push_back(i);
+        }
+        return ids;
+    }
+
+    bool sortedAndUnique(const std::vector<size_t>& ids) {
+        return std::adjacent_find(ids.begin(), ids.end(), [](size_t a, size_t b) { return a >= b; }) == ids.end();
+    }
+
+    void fill(SpatialGrid& grid, const std::vector<sf::FloatRect>& bounds) {
+        grid.clear();
+        for (size_t i = 0; i < bounds.size(); ++i) grid.insert(i, bounds[i]);
+        grid.build();
+    }
+
+    void testMatchesBruteForce() {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(-3000.0f, 3000.0f);
+        std::uniform_real_distribution<float> small(1.0f, 100.0f);
+        std::uniform_real_distribution<float> large(100.0f, 600.0f);
+
+        for (size_t buckets : {1u, 4u, 64u, 1024u}) {
+            for (float cellSize : {48.0f, 200.0f}) {
+                SpatialGrid grid(cellSize, buckets);
+                std::vector<sf::FloatRect> bounds(600);
+                for (size_t i = 0; i < bounds.size(); ++i) {
+                    bool big = (i % 20 == 0); // A few entities span many cells
+                    bounds[i] = sf::FloatRect(pos(rng), pos(rng), big ? large(rng) : small(rng), big ? large(rng) : small(rng));
+                }
+                fill(grid, bounds);
+                CHECK(grid.size() == bounds.size());
+
+                int mismatches = 0, unsorted = 0;
+                std::vector<size_t> out;
+                for (int q = 0; q < 500; ++q) {
+                    sf::FloatRect area(pos(rng), pos(rng), rng() % 2 ? small(rng) : large(rng), rng() % 2 ? small(rng) : large(rng));
+                    grid.queryRect(area, out);
+                    if (out != bruteRect(bounds, area)) mismatches++;
+                    if (!sortedAndUnique(out)) unsorted++;
+
+                    sf::Vector2f center(pos(rng), pos(rng));
+                    float radius = (q % 10 == 0) ? 0.0f : small(rng) * 5.0f;
+                    grid.queryRadius(center, radius, out);
+                    if (out != bruteRadius(bounds, center, radius)) mismatches++;
+                    if (!sortedAndUnique(out)) unsorted++;
+                }
+                CHECK(mismatches == 0);
+                CHECK(unsorted == 0);
+            }
+        }
+    }
+
+    void testSpanningEntityReportedOnce() {
+        SpatialGrid grid(10.0f, 16);
+        std::vector<sf::FloatRect> bounds = {
+            sf::FloatRect(-55.0f, -55.0f, 200.0f, 200.0f), // ~400 cells, many per bucket
+            sf::FloatRect(5.0f, 5.0f, 2.0f, 2.0f)
+        };
+        fill(grid, bounds);
+
+        std::vector<size_t> out;
+        grid.queryRect(sf::FloatRect(-100.0f, -100.0f, 400.0f, 400.0f), out);
+        CHECK(out == std::vector<size_t>({0, 1}));
+        grid.queryRadius(sf::Vector2f(40.0f, 40.0f), 150.0f, out);
+        CHECK(out == std::vector<size_t>({0, 1}));
+    }
+
+    void testCollidingBucketsAreFiltered() {
+        // One bucket: every cell collides, so only the exact test separates entities
+        SpatialGrid grid(16.0f, 1);
+        std::vector<sf::FloatRect> bounds = {
+            sf::FloatRect(0.0f, 0.0f, 8.0f, 8.0f),
+            sf::FloatRect(10000.0f, -10000.0f, 8.0f, 8.0f),
+            sf::FloatRect(-5000.0f, 20.0f, 8.0f, 8.0f)
+        };
+        fill(grid, bounds);
+
+        std::vector<size_t> out;
+        grid.queryRect(sf::FloatRect(-4.0f, -4.0f, 10.0f, 10.0f), out);
+        CHECK(out == std::vector<size_t>({0}));
+        grid.queryRadius(sf::Vector2f(10004.0f, -9990.0f), 8.0f, out);
+        CHECK(out == std::vector<size_t>({1}));
+        grid.queryRect(sf::FloatRect(100.0f, 100.0f, 10.0f, 10.0f), out);
+        CHECK(out.empty());
+    }
+
+    void testRebuildAndEmpty() {
+        SpatialGrid grid(64.0f);
+        std::vector<size_t> out;
+        grid.build();
+        grid.queryRect(sf::FloatRect(-1000.0f, -1000.0f, 2000.0f, 2000.0f), out);
+        CHECK(out.empty());
+
+        fill(grid, {sf::FloatRect(0.0f, 0.0f, 10.0f, 10.0f), sf::FloatRect(20.0f, 0.0f, 10.0f, 10.0f)});
+        grid.queryRect(sf::FloatRect(-5.0f, -5.0f, 50.0f, 20.0f), out);
+        CHECK(out.size() == 2);
+
+        // A smaller population after clear() must not report stale ids
+        fill(grid, {sf::FloatRect(500.0f, 500.0f, 10.0f, 10.0f)});
+        grid.queryRect(sf::FloatRect(-5.0f, -5.0f, 50.0f, 20.0f), out);
+        CHECK(out.empty());
+        grid.queryRect(sf::FloatRect(495.0f, 495.0f, 10.0f, 10.0f), out);
+        CHECK(out == std::vector<size_t>({0}));
+
+        // Between clear() and build() queries see nothing
+        grid.clear();
+        grid.queryRect(sf::FloatRect(495.0f, 495.0f, 10.0f, 10.0f), out);
+        CHECK(out.empty());
+    }
+}
+
+int main() {
+    testMatchesBruteForce();
+    testSpanningEntityReportedOnce();
+    testCollidingBucketsAreFiltered();
+    testRebuildAndEmpty();
+
+    if (failures == 0) std::printf("SpatialGrid: all tests passed\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,233 @@
+#include "TileCollision.h"
+#include "World.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+/**
+ * Unit tests for TileCollision against a hand-built ChunkStore (no World,
+ * no window). Resident chunks cover columns -48..47; everything outside is
+ * non-resident and must read as solid.
+ */
+
+namespace {
+    const float T = 32.0f; // Tile size used by every test
+    int failures = 0;
+
+    #define CHECK(cond) do { \
+        if (!(cond)) { std::printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+    } while (0)
+
+    bool near(float a, float b) { return std::abs(a - b) < 1e-3f; }
+
+    /**
+     * Fresh store with Complete, empty chunks -3..2 and a floor on row 100.
+     */
+    struct Fixture {
+        ChunkStore store;
+        TileCollision collision;
+
+        Fixture() : collision(store, T) {
+            for (int chunkX = -3; chunkX <= 2; ++chunkX) {
+                auto chunk = std::make_unique<Chunk>();
+                chunk->blocks = BlockStorage(CHUNK_WIDTH * WORLD_HEIGHT);
+                chunk->walls = BlockStorage(CHUNK_WIDTH * WORLD_HEIGHT);
+                chunk->solid.assign(WORLD_HEIGHT, 0);
+                chunk->stage = ChunkStage::Complete;
+                store.insert(chunkX, std::move(chunk));
+            }
+            for (int x = -48; x < 48; ++x) set(x, 100, ItemID::STONE);
+        }
+
+        // Same bookkeeping as World::setBlock: block layer plus solid bit
+        void set(int x, int y, int id) {
+            Chunk* chunk = store.find(x >> CHUNK_SHIFT);
+            int lx = x & CHUNK_MASK;
+            chunk->blocks.set(y * CHUNK_WIDTH + lx, id);
+            uint16_t bit = static_cast<uint16_t>(1u << lx);
+            if (World::isSolid(id)) chunk->solid[y] |= bit;
+            else chunk->solid[y] &= static_cast<uint16_t>(~bit);
+        }
+    };
+
+    const float FLOOR_Y = 100 * T; // Top face of the floor
+
+    void testLanding() {
+        Fixture f;
+        sf::FloatRect box(10.0f, FLOOR_Y - 100.0f, 20.0f, 60.0f);
+        TileCollision::MoveResult m = f.collision.move(box, sf::Vector2f(0.0f, 100.0f));
+        CHECK(m.hitFloor && !m.hitCeiling);
+        CHECK(near(box.top + box.height + m.offset.y, FLOOR_Y));
+
+        // Resting on the floor: slides freely and is grounded
+        sf::FloatRect rest(10.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        m = f.collision.move(rest, sf::Vector2f(50.0f, 5.0f));
+        CHECK(!m.hitWall && near(m.offset.x, 50.0f));
+        CHECK(m.hitFloor && near(m.offset.y, 0.0f));
+        CHECK(f.collision.isOnGround(rest));
+        CHECK(!f.collision.isOnGround(sf::FloatRect(10.0f, FLOOR_Y - 70.0f, 20.0f, 60.0f)));
+    }
+
+    void testWalls() {
+        Fixture f;
+        for (int y = 97; y < 100; ++y) f.set(5, y, ItemID::STONE); // 3 tiles high: too tall to step
+        sf::FloatRect rest(10.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+
+        TileCollision::SweepHit hit = f.collision.sweep(rest, sf::Vector2f(200.0f, 0.0f));
+        CHECK(hit.hit && hit.tile.x == 5);
+        CHECK(hit.normal.x == -1.0f && hit.normal.y == 0.0f);
+        CHECK(near(hit.time, (5 * T - 30.0f) / 200.0f));
+
+        TileCollision::MoveResult m = f.collision.move(rest, sf::Vector2f(200.0f, 0.0f), T + 0.1f);
+        CHECK(m.hitWall && !m.stepped);
+        CHECK(near(rest.left + rest.width + m.offset.x, 5 * T));
+
+        // Creeping into a touching wall never pushes through it
+        sf::FloatRect touch(5 * T - 20.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        for (int i = 0; i < 1000; ++i) touch.left += f.collision.move(touch, sf::Vector2f(0.005f, 0.0f)).offset.x;
+        CHECK(touch.left + touch.width <= 5 * T + 1e-3f);
+
+        // Passable blocks (open doors, trunks) do not block
+        f.set(8, 99, ItemID::DOOR_OPEN);
+        f.set(8, 98, ItemID::WOOD);
+        CHECK(!f.collision.isSolidTile(8, 99) && !f.collision.isSolidTile(8, 98));
+    }
+
+    void testAutoStep() {
+        Fixture f;
+        f.set(3, 99, ItemID::DIRT); // One-tile ledge
+        sf::FloatRect walker(40.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+
+        TileCollision::MoveResult m = f.collision.move(walker, sf::Vector2f(80.0f, 0.0f), T + 0.1f);
+        CHECK(m.stepped && !m.hitWall);
+        CHECK(near(walker.top + walker.height + m.offset.y, FLOOR_Y - T)); // Standing on the ledge
+        CHECK(near(m.offset.x, 80.0f));
+
+        // Disabled stepping stops at the ledge instead
+        m = f.collision.move(walker, sf::Vector2f(80.0f, 0.0f));
+        CHECK(m.hitWall && !m.stepped);
+        CHECK(near(walker.left + walker.width + m.offset.x, 3 * T));
+
+        // No step when the headroom above is blocked
+        for (int x = 0; x < 6; ++x) f.set(x, 97, ItemID::STONE);
+        m = f.collision.move(walker, sf::Vector2f(80.0f, 0.0f), T + 0.1f);
+        CHECK(m.hitWall && !m.stepped);
+    }
+
+    void testCeiling() {
+        Fixture f;
+        for (int x = 20; x < 24; ++x) f.set(x, 90, ItemID::STONE);
+        sf::FloatRect jumper(20 * T + 2.0f, 91 * T + 10.0f, 20.0f, 40.0f);
+        TileCollision::MoveResult m = f.collision.move(jumper, sf::Vector2f(0.0f, -100.0f));
+        CHECK(m.hitCeiling && !m.hitFloor);
+        CHECK(near(jumper.top + m.offset.y, 91 * T));
+    }
+
+    void testNoTunnelling() {
+        Fixture f;
+        // Thin floor, motion many tiles long in one step
+        sf::FloatRect fast(400.0f, 0.0f, 20.0f, 20.0f);
+        TileCollision::MoveResult m = f.collision.move(fast, sf::Vector2f(0.0f, 5000.0f));
+        CHECK(m.hitFloor && near(fast.top + fast.height + m.offset.y, FLOOR_Y));
+
+        // One-tile wall, horizontal motion far larger than a tile
+        for (int y = 90; y < 100; ++y) f.set(20, y, ItemID::STONE);
+        sf::FloatRect bullet(0.0f, 95 * T, 4.0f, 4.0f);
+        m = f.collision.move(bullet, sf::Vector2f(3000.0f, 0.0f));
+        CHECK(m.hitWall && near(bullet.left + bullet.width + m.offset.x, 20 * T));
+
+        // Diagonal sweep
+        TileCollision::SweepHit hit = f.collision.sweep(sf::FloatRect(0.0f, 80 * T, 4.0f, 4.0f), sf::Vector2f(2000.0f, 2000.0f));
+        CHECK(hit.hit && hit.time < 1.0f);
+    }
+
+    void testNonResidentChunksAreSolid() {
+        Fixture f;
+        CHECK(f.collision.isSolidTile(16 * 10, 50));  // Chunk 10 never inserted
+        CHECK(f.collision.isSolidTile(-16 * 10, 50)); // Neither is chunk -10
+        CHECK(!f.collision.isSolidTile(0, 50));       // Resident air
+        CHECK(!f.collision.isSolidTile(0, -1) && !f.collision.isSolidTile(0, WORLD_HEIGHT)); // Above/below the world
+
+        // Walking towards the edge of the resident area stops at it
+        sf::FloatRect walker(47 * T - 30.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        TileCollision::MoveResult m = f.collision.move(walker, sf::Vector2f(200.0f, 0.0f));
+        CHECK(m.hitWall && near(walker.left + walker.width + m.offset.x, 48 * T));
+
+        // A chunk that is resident but not Complete also counts as solid
+        auto partial = std::make_unique<Chunk>();
+        partial->stage = ChunkStage::Terrain;
+        f.store.insert(5, std::move(partial));
+        CHECK(f.collision.isSolidTile(5 * CHUNK_WIDTH + 3, 10));
+    }
+
+    void testNegativeCoordinates() {
+        Fixture f;
+        // Chunk boundaries at x = -16 and x = -32 tiles
+        sf::FloatRect rest(-200.0f, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        TileCollision::MoveResult m = f.collision.move(rest, sf::Vector2f(-50.0f, 5.0f));
+        CHECK(!m.hitWall && near(m.offset.x, -50.0f) && m.hitFloor);
+
+        f.set(-17, 99, ItemID::STONE);
+        f.set(-17, 98, ItemID::STONE);
+        CHECK(f.collision.isSolidTile(-17, 99));
+        sf::FloatRect walker(-15 * T, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        m = f.collision.move(walker, sf::Vector2f(-100.0f, 0.0f));
+        CHECK(m.hitWall && near(walker.left + m.offset.x, -16 * T));
+
+        f.set(-33, 99, ItemID::DIRT); // Ledge on the far side of the -32 chunk boundary
+        sf::FloatRect stepper(-31 * T, FLOOR_Y - 60.0f, 20.0f, 60.0f);
+        m = f.collision.move(stepper, sf::Vector2f(-80.0f, 0.0f), T + 0.1f);
+        CHECK(m.stepped && near(stepper.top + stepper.height + m.offset.y, FLOOR_Y - T));
+    }
+
+    void testStuckInsideTile() {
+        Fixture f;
+        f.set(5, 98, ItemID::STONE);
+        sf::FloatRect stuck(5 * T + 4.0f, 98 * T + 2.0f, 10.0f, 10.0f);
+        CHECK(f.collision.overlapsSolid(stuck));
+        TileCollision::MoveResult m = f.collision.move(stuck, sf::Vector2f(-30.0f, 0.0f));
+        CHECK(!m.hitWall && near(m.offset.x, -30.0f));
+    }
+
+    void testRandomMovesNeverPenetrate() {
+        Fixture f;
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        for (int x = -48; x < 48; ++x) {
+            for (int y = 60; y < 100; ++y) {
+                if (unit(rng) < 0.25f) f.set(x, y, ItemID::STONE);
+            }
+        }
+
+        int violations = 0;
+        for (int i = 0; i < 50000; ++i) {
+            sf::FloatRect box(-1400.0f + unit(rng) * 2800.0f, 60 * T + unit(rng) * 38 * T,
+                              8.0f + unit(rng) * 50.0f, 8.0f + unit(rng) * 80.0f);
+            if (f.collision.overlapsSolid(box)) continue;
+
+            sf::Vector2f motion((unit(rng) - 0.5f) * 400.0f, (unit(rng) - 0.5f) * 400.0f);
+            TileCollision::MoveResult m = f.collision.move(box, motion, unit(rng) < 0.5f ? T + 0.1f : 0.0f);
+            if (f.collision.overlapsSolid(sf::FloatRect(box.left + m.offset.x, box.top + m.offset.y, box.width, box.height))) violations++;
+
+            TileCollision::SweepHit hit = f.collision.sweep(box, motion);
+            sf::FloatRect atContact(box.left + motion.x * hit.time, box.top + motion.y * hit.time, box.width, box.height);
+            if (f.collision.overlapsSolid(atContact)) violations++;
+        }
+        CHECK(violations == 0);
+    }
+}
+
+int main() {
+    testLanding();
+    testWalls();
+    testAutoStep();
+    testCeiling();
+    testNoTunnelling();
+    testNonResidentChunksAreSolid();
+    testNegativeCoordinates();
+    testStuckInsideTile();
+    testRandomMovesNeverPenetrate();
+
+    if (failures == 0) std::printf("TileCollision: all tests passed\n");
+    return failures == 0 ? 0 : 1;
+}